@@ -374,6 +374,10 @@ def command_run(args, config):
     if exit_code != 0:
         return exit_code
     _LOGGER.info("Successfully compiled program.")
+    if CORE.is_host:
+        # There is nothing to upload, run the program in the foreground instead
+        program = CORE.relative_pioenvs_path(CORE.name, "program")
+        return run_external_process(program)
     port = choose_upload_log_host(
         default=args.device,
         check_default=None,
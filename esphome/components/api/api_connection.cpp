@@ -93,6 +93,9 @@ void APIConnection::loop() {
   this->list_entities_iterator_.advance();
   this->initial_state_iterator_.advance();
 
+  if (!this->deferred_states_.empty() && millis() - this->batch_start_ >= this->parent_->get_batch_delay())
+    this->flush_deferred_states_();
+
   const uint32_t keepalive = 60000;
   const uint32_t now = millis();
   if (this->sent_ping_) {
@@ -110,7 +113,8 @@ void APIConnection::loop() {
 #ifdef USE_ESP32_CAMERA
   if (this->image_reader_.available() && this->helper_->can_write_without_blocking()) {
     uint32_t to_send = std::min((size_t) 1024, this->image_reader_.available());
-    auto buffer = this->create_buffer();
+    // key, data (with up to 2 bytes of length) and done fields
+    auto buffer = this->create_buffer(5 + 3 + to_send + 2);
     // fixed32 key = 1;
     buffer.encode_fixed32(1, esp32_camera::global_esp32_camera->get_object_id_hash());
     // bytes data = 2;
@@ -166,6 +170,8 @@ void APIConnection::on_disconnect_response(const DisconnectResponse &value) {
 bool APIConnection::send_binary_sensor_state(binary_sensor::BinarySensor *binary_sensor, bool state) {
   if (!this->state_subscription_)
     return false;
+  if (this->defer_state_(binary_sensor, DeferredState::BINARY_SENSOR))
+    return true;
 
   BinarySensorStateResponse resp;
   resp.key = binary_sensor->get_object_id_hash();
@@ -192,6 +198,8 @@ bool APIConnection::send_binary_sensor_info(binary_sensor::BinarySensor *binary_
 bool APIConnection::send_cover_state(cover::Cover *cover) {
   if (!this->state_subscription_)
     return false;
+  if (this->defer_state_(cover, DeferredState::COVER))
+    return true;
 
   auto traits = cover->get_traits();
   CoverStateResponse resp{};
@@ -253,6 +261,8 @@ void APIConnection::cover_command(const CoverCommandRequest &msg) {
 bool APIConnection::send_fan_state(fan::Fan *fan) {
   if (!this->state_subscription_)
     return false;
+  if (this->defer_state_(fan, DeferredState::FAN))
+    return true;
 
   auto traits = fan->get_traits();
   FanStateResponse resp{};
@@ -307,6 +317,8 @@ void APIConnection::fan_command(const FanCommandRequest &msg) {
 bool APIConnection::send_light_state(light::LightState *light) {
   if (!this->state_subscription_)
     return false;
+  if (this->defer_state_(light, DeferredState::LIGHT))
+    return true;
 
   auto traits = light->get_traits();
   auto values = light->remote_values;
@@ -404,6 +416,8 @@ void APIConnection::light_command(const LightCommandRequest &msg) {
 bool APIConnection::send_sensor_state(sensor::Sensor *sensor, float state) {
   if (!this->state_subscription_)
     return false;
+  if (this->defer_state_(sensor, DeferredState::SENSOR))
+    return true;
 
   SensorStateResponse resp{};
   resp.key = sensor->get_object_id_hash();
@@ -435,6 +449,8 @@ bool APIConnection::send_sensor_info(sensor::Sensor *sensor) {
 bool APIConnection::send_switch_state(switch_::Switch *a_switch, bool state) {
   if (!this->state_subscription_)
     return false;
+  if (this->defer_state_(a_switch, DeferredState::SWITCH))
+    return true;
 
   SwitchStateResponse resp{};
   resp.key = a_switch->get_object_id_hash();
@@ -471,6 +487,8 @@ void APIConnection::switch_command(const SwitchCommandRequest &msg) {
 bool APIConnection::send_text_sensor_state(text_sensor::TextSensor *text_sensor, std::string state) {
   if (!this->state_subscription_)
     return false;
+  if (this->defer_state_(text_sensor, DeferredState::TEXT_SENSOR))
+    return true;
 
   TextSensorStateResponse resp{};
   resp.key = text_sensor->get_object_id_hash();
@@ -497,6 +515,8 @@ bool APIConnection::send_text_sensor_info(text_sensor::TextSensor *text_sensor)
 bool APIConnection::send_climate_state(climate::Climate *climate) {
   if (!this->state_subscription_)
     return false;
+  if (this->defer_state_(climate, DeferredState::CLIMATE))
+    return true;
 
   auto traits = climate->get_traits();
   ClimateStateResponse resp{};
@@ -595,6 +615,8 @@ void APIConnection::climate_command(const ClimateCommandRequest &msg) {
 bool APIConnection::send_number_state(number::Number *number, float state) {
   if (!this->state_subscription_)
     return false;
+  if (this->defer_state_(number, DeferredState::NUMBER))
+    return true;
 
   NumberStateResponse resp{};
   resp.key = number->get_object_id_hash();
@@ -635,6 +657,8 @@ void APIConnection::number_command(const NumberCommandRequest &msg) {
 bool APIConnection::send_select_state(select::Select *select, std::string state) {
   if (!this->state_subscription_)
     return false;
+  if (this->defer_state_(select, DeferredState::SELECT))
+    return true;
 
   SelectStateResponse resp{};
   resp.key = select->get_object_id_hash();
@@ -694,6 +718,8 @@ void APIConnection::button_command(const ButtonCommandRequest &msg) {
 bool APIConnection::send_lock_state(lock::Lock *a_lock, lock::LockState state) {
   if (!this->state_subscription_)
     return false;
+  if (this->defer_state_(a_lock, DeferredState::LOCK))
+    return true;
 
   LockStateResponse resp{};
   resp.key = a_lock->get_object_id_hash();
@@ -737,6 +763,8 @@ void APIConnection::lock_command(const LockCommandRequest &msg) {
 bool APIConnection::send_media_player_state(media_player::MediaPlayer *media_player) {
   if (!this->state_subscription_)
     return false;
+  if (this->defer_state_(media_player, DeferredState::MEDIA_PLAYER))
+    return true;
 
   MediaPlayerStateResponse resp{};
   resp.key = media_player->get_object_id_hash();
@@ -828,11 +856,13 @@ bool APIConnection::send_log_message(int level, const char *tag, const char *lin
     return false;
 
   // Send raw so that we don't copy too much
-  auto buffer = this->create_buffer();
+  const size_t line_len = strlen(line);
+  // level and message (with up to 3 bytes of length)
+  auto buffer = this->create_buffer(2 + 4 + line_len);
   // LogLevel level = 1;
   buffer.encode_uint32(1, static_cast<uint32_t>(level));
   // string message = 3;
-  buffer.encode_string(3, line, strlen(line));
+  buffer.encode_string(3, line, line_len);
   // SubscribeLogsResponse - 29
   return this->send_buffer(buffer, 29);
 }
@@ -913,6 +943,15 @@ void APIConnection::subscribe_home_assistant_states(const SubscribeHomeAssistant
 bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) {
   if (this->remove_)
     return false;
+  if (this->batch_flushing_) {
+    // Collected and written by flush_deferred_states_()
+    const uint32_t payload_start = this->batch_packet_start_ + this->helper_->frame_header_padding();
+    this->batch_packets_.push_back(
+        {static_cast<uint16_t>(message_type), this->batch_packet_start_,
+         static_cast<uint32_t>(this->proto_write_buffer_.size() - payload_start)});
+    this->proto_write_buffer_.resize(this->proto_write_buffer_.size() + this->helper_->frame_footer_size());
+    return true;
+  }
   if (!this->helper_->can_write_without_blocking()) {
     delay(0);
     APIError err = helper_->loop();
@@ -922,6 +961,7 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
       return false;
     }
     if (!this->helper_->can_write_without_blocking()) {
+      this->dropped_messages_++;
       // SubscribeLogsResponse
       if (message_type != 29) {
         ESP_LOGV(TAG, "Cannot send message because of TCP buffer space");
@@ -931,7 +971,7 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
     }
   }
 
-  APIError err = this->helper_->write_packet(message_type, buffer.get_buffer()->data(), buffer.get_buffer()->size());
+  APIError err = this->helper_->write_protobuf_packet(message_type, buffer);
   if (err == APIError::WOULD_BLOCK)
     return false;
   if (err != APIError::OK) {
@@ -946,6 +986,133 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
   // Do not set last_traffic_ on send
   return true;
 }
+bool APIConnection::defer_state_(EntityBase *entity, DeferredState kind) {
+  if (this->batch_flushing_)
+    return false;
+  // Without batching, states are only queued while the socket is busy. Once something is queued, later states
+  // are queued behind it so that they are not sent out of order.
+  if (this->parent_->get_batch_delay() == 0 && this->deferred_states_.empty() &&
+      this->helper_->can_write_without_blocking())
+    return false;
+  // The state is read from the entity when the batch is sent, so later updates replace queued ones
+  for (auto &entry : this->deferred_states_) {
+    if (entry.entity == entity) {
+      this->coalesced_states_++;
+      return true;
+    }
+  }
+  if (this->deferred_states_.empty())
+    this->batch_start_ = millis();
+  this->deferred_states_.push_back({entity, kind});
+  return true;
+}
+void APIConnection::send_deferred_state_(const DeferredStateEntry &entry) {
+  switch (entry.kind) {
+#ifdef USE_BINARY_SENSOR
+    case DeferredState::BINARY_SENSOR: {
+      auto *binary_sensor = static_cast<binary_sensor::BinarySensor *>(entry.entity);
+      this->send_binary_sensor_state(binary_sensor, binary_sensor->state);
+      break;
+    }
+#endif
+#ifdef USE_COVER
+    case DeferredState::COVER:
+      this->send_cover_state(static_cast<cover::Cover *>(entry.entity));
+      break;
+#endif
+#ifdef USE_FAN
+    case DeferredState::FAN:
+      this->send_fan_state(static_cast<fan::Fan *>(entry.entity));
+      break;
+#endif
+#ifdef USE_LIGHT
+    case DeferredState::LIGHT:
+      this->send_light_state(static_cast<light::LightState *>(entry.entity));
+      break;
+#endif
+#ifdef USE_SENSOR
+    case DeferredState::SENSOR: {
+      auto *sensor = static_cast<sensor::Sensor *>(entry.entity);
+      this->send_sensor_state(sensor, sensor->state);
+      break;
+    }
+#endif
+#ifdef USE_SWITCH
+    case DeferredState::SWITCH: {
+      auto *a_switch = static_cast<switch_::Switch *>(entry.entity);
+      this->send_switch_state(a_switch, a_switch->state);
+      break;
+    }
+#endif
+#ifdef USE_TEXT_SENSOR
+    case DeferredState::TEXT_SENSOR: {
+      auto *text_sensor = static_cast<text_sensor::TextSensor *>(entry.entity);
+      this->send_text_sensor_state(text_sensor, text_sensor->state);
+      break;
+    }
+#endif
+#ifdef USE_CLIMATE
+    case DeferredState::CLIMATE:
+      this->send_climate_state(static_cast<climate::Climate *>(entry.entity));
+      break;
+#endif
+#ifdef USE_NUMBER
+    case DeferredState::NUMBER: {
+      auto *number = static_cast<number::Number *>(entry.entity);
+      this->send_number_state(number, number->state);
+      break;
+    }
+#endif
+#ifdef USE_SELECT
+    case DeferredState::SELECT: {
+      auto *select = static_cast<select::Select *>(entry.entity);
+      this->send_select_state(select, select->state);
+      break;
+    }
+#endif
+#ifdef USE_LOCK
+    case DeferredState::LOCK: {
+      auto *a_lock = static_cast<lock::Lock *>(entry.entity);
+      this->send_lock_state(a_lock, a_lock->state);
+      break;
+    }
+#endif
+#ifdef USE_MEDIA_PLAYER
+    case DeferredState::MEDIA_PLAYER:
+      this->send_media_player_state(static_cast<media_player::MediaPlayer *>(entry.entity));
+      break;
+#endif
+    default:
+      break;
+  }
+}
+void APIConnection::flush_deferred_states_() {
+  // Queued entries keep coalescing until the socket can take the batch
+  // (helper_->loop() keeps draining the socket buffer meanwhile)
+  if (!this->helper_->can_write_without_blocking())
+    return;
+
+  this->proto_write_buffer_.clear();
+  this->batch_packets_.clear();
+  this->batch_flushing_ = true;
+  size_t count = 0;
+  while (count < this->deferred_states_.size() && this->proto_write_buffer_.size() < MAX_BATCH_SIZE) {
+    this->send_deferred_state_(this->deferred_states_[count]);
+    count++;
+  }
+  this->batch_flushing_ = false;
+  // Whatever did not fit is sent with the next loop
+  this->deferred_states_.erase(this->deferred_states_.begin(), this->deferred_states_.begin() + count);
+
+  if (this->batch_packets_.empty())
+    return;
+  APIError err = this->helper_->write_protobuf_packets(ProtoWriteBuffer(&this->proto_write_buffer_),
+                                                       this->batch_packets_.data(), this->batch_packets_.size());
+  if (err != APIError::OK && err != APIError::WOULD_BLOCK) {
+    on_fatal_error();
+    ESP_LOGW(TAG, "%s: Packet write failed %s errno=%d", client_info_.c_str(), api_error_to_str(err), errno);
+  }
+}
 void APIConnection::on_unauthenticated_access() {
   this->on_fatal_error();
   ESP_LOGD(TAG, "%s: tried to access without authentication.", this->client_info_.c_str());
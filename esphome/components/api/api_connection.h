@@ -2,6 +2,7 @@
 
 #include "esphome/core/component.h"
 #include "esphome/core/application.h"
+#include "esphome/core/entity_base.h"
 #include "api_pb2.h"
 #include "api_pb2_service.h"
 #include "api_server.h"
@@ -89,6 +90,15 @@ class APIConnection : public APIServerConnection {
   void media_player_command(const MediaPlayerCommandRequest &msg) override;
 #endif
   bool send_log_message(int level, const char *tag, const char *line);
+
+  /// State updates waiting for the socket or the batch delay, this is bounded by one entry per entity.
+  size_t get_state_backlog() const { return this->deferred_states_.size(); }
+  /// Bytes of written messages still waiting in the frame helper.
+  size_t get_tx_backlog() const { return this->helper_->get_tx_backlog(); }
+  /// Messages that were dropped because the socket could not take them, queued state updates are not included.
+  uint32_t get_dropped_messages() const { return this->dropped_messages_; }
+  /// State updates that replaced an older queued state of the same entity before it was sent.
+  uint32_t get_coalesced_states() const { return this->coalesced_states_; }
   void send_homeassistant_service_call(const HomeassistantServiceResponse &call) {
     if (!this->service_call_subscription_)
       return;
@@ -141,9 +151,19 @@ class APIConnection : public APIServerConnection {
   void on_fatal_error() override;
   void on_unauthenticated_access() override;
   void on_no_setup_connection() override;
-  ProtoWriteBuffer create_buffer() override {
+  ProtoWriteBuffer create_buffer(uint32_t reserve_size) override {
     // FIXME: ensure no recursive writes can happen
+    // The frame header is filled in front of the message when it is sent, see APIFrameHelper::write_protobuf_packet
+    const uint8_t header_padding = this->helper_->frame_header_padding();
+    if (this->batch_flushing_) {
+      // Messages of a batch are encoded back to back, send_buffer() leaves room for the footer behind each one
+      this->batch_packet_start_ = this->proto_write_buffer_.size();
+      this->proto_write_buffer_.resize(this->batch_packet_start_ + header_padding);
+      return {&this->proto_write_buffer_};
+    }
     this->proto_write_buffer_.clear();
+    this->proto_write_buffer_.reserve(header_padding + reserve_size + this->helper_->frame_footer_size());
+    this->proto_write_buffer_.resize(header_padding);
     return {&this->proto_write_buffer_};
   }
   bool send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) override;
@@ -153,6 +173,34 @@ class APIConnection : public APIServerConnection {
 
   bool send_(const void *buf, size_t len, bool force);
 
+  /// Upper bound of the encoded messages sent in one batch, further updates go out with the next one.
+  static const size_t MAX_BATCH_SIZE = 1400;
+
+  /// Entities whose state updates can be batched.
+  enum class DeferredState : uint8_t {
+    BINARY_SENSOR,
+    COVER,
+    FAN,
+    LIGHT,
+    SENSOR,
+    SWITCH,
+    TEXT_SENSOR,
+    CLIMATE,
+    NUMBER,
+    SELECT,
+    LOCK,
+    MEDIA_PLAYER,
+  };
+  struct DeferredStateEntry {
+    EntityBase *entity;
+    DeferredState kind;
+  };
+
+  /// Queue a state update for the next batch or until the socket is writable, returns false to send it right away.
+  bool defer_state_(EntityBase *entity, DeferredState kind);
+  void send_deferred_state_(const DeferredStateEntry &entry);
+  void flush_deferred_states_();
+
   enum class ConnectionState {
     WAITING_FOR_HELLO,
     CONNECTED,
@@ -181,6 +229,15 @@ class APIConnection : public APIServerConnection {
   InitialStateIterator initial_state_iterator_;
   ListEntitiesIterator list_entities_iterator_;
   int state_subs_at_ = -1;
+
+  // State updates waiting for the batch delay, at most one per entity
+  std::vector<DeferredStateEntry> deferred_states_;
+  std::vector<PacketInfo> batch_packets_;
+  uint32_t batch_start_{0};
+  uint32_t batch_packet_start_{0};
+  bool batch_flushing_{false};
+  uint32_t dropped_messages_{0};
+  uint32_t coalesced_states_{0};
 };
 
 }  // namespace api
@@ -5,6 +5,7 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/application.h"
 #include "proto.h"
+#include <algorithm>
 #include <cstring>
 
 namespace esphome {
@@ -467,7 +468,8 @@ APIError APINoiseFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   return APIError::OK;
 }
 bool APINoiseFrameHelper::can_write_without_blocking() { return state_ == State::DATA && tx_buf_.empty(); }
-APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload, size_t payload_len) {
+APIError APINoiseFrameHelper::write_protobuf_packets(ProtoWriteBuffer buffer, const PacketInfo *packets,
+                                                     size_t count) {
   int err;
   APIError aerr;
   aerr = state_action_();
@@ -478,46 +480,58 @@ APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload
   if (state_ != State::DATA) {
     return APIError::WOULD_BLOCK;
   }
+  if (count == 0)
+    return APIError::OK;
 
-  size_t padding = 0;
-  size_t msg_len = 4 + payload_len + padding;
-  size_t frame_len = 3 + msg_len + noise_cipherstate_get_mac_length(send_cipher_);
-  auto tmpbuf = std::unique_ptr<uint8_t[]>{new (std::nothrow) uint8_t[frame_len]};
-  if (tmpbuf == nullptr) {
-    HELPER_LOG("Could not allocate for writing packet");
-    return APIError::OUT_OF_MEMORY;
-  }
+  std::vector<uint8_t> *raw_buffer = buffer.get_buffer();
+  const size_t mac_len = noise_cipherstate_get_mac_length(send_cipher_);
+  if (count > 1 && mac_len > frame_footer_size_)
+    return APIError::BAD_STATE;
+  const PacketInfo &last = packets[count - 1];
+  const size_t end = last.offset + frame_header_padding_ + last.payload_size;
+  if (end > raw_buffer->size())
+    return APIError::BAD_ARG;
+  // room for the MAC of the last message, reserved by the connection together with the header
+  raw_buffer->resize(std::max(raw_buffer->size(), end + mac_len));
+  uint8_t *data = raw_buffer->data();
+
+  size_t write_pos = 0;
+  for (size_t i = 0; i < count; i++) {
+    const PacketInfo &packet = packets[i];
+    uint8_t *buf_start = data + packet.offset;
+    const size_t msg_len = 4 + packet.payload_size;
+
+    buf_start[0] = 0x01;  // indicator
+    // buf_start[1], buf_start[2] to be set later
+    const uint8_t msg_offset = 3;
+    buf_start[msg_offset + 0] = (uint8_t)(packet.message_type >> 8);  // type
+    buf_start[msg_offset + 1] = (uint8_t) packet.message_type;
+    buf_start[msg_offset + 2] = (uint8_t)(packet.payload_size >> 8);  // data_len
+    buf_start[msg_offset + 3] = (uint8_t) packet.payload_size;
+
+    // encrypt the message in place, the payload already follows the type and length
+    NoiseBuffer mbuf;
+    noise_buffer_init(mbuf);
+    noise_buffer_set_inout(mbuf, buf_start + msg_offset, msg_len, msg_len + mac_len);
+    err = noise_cipherstate_encrypt(send_cipher_, &mbuf);
+    if (err != 0) {
+      state_ = State::FAILED;
+      HELPER_LOG("noise_cipherstate_encrypt failed: %s", noise_err_to_str(err).c_str());
+      return APIError::CIPHERSTATE_ENCRYPT_FAILED;
+    }
 
-  tmpbuf[0] = 0x01;  // indicator
-  // tmpbuf[1], tmpbuf[2] to be set later
-  const uint8_t msg_offset = 3;
-  const uint8_t payload_offset = msg_offset + 4;
-  tmpbuf[msg_offset + 0] = (uint8_t)(type >> 8);  // type
-  tmpbuf[msg_offset + 1] = (uint8_t) type;
-  tmpbuf[msg_offset + 2] = (uint8_t)(payload_len >> 8);  // data_len
-  tmpbuf[msg_offset + 3] = (uint8_t) payload_len;
-  // copy data
-  std::copy(payload, payload + payload_len, &tmpbuf[payload_offset]);
-  // fill padding with zeros
-  std::fill(&tmpbuf[payload_offset + payload_len], &tmpbuf[frame_len], 0);
+    buf_start[1] = (uint8_t)(mbuf.size >> 8);
+    buf_start[2] = (uint8_t) mbuf.size;
 
-  NoiseBuffer mbuf;
-  noise_buffer_init(mbuf);
-  noise_buffer_set_inout(mbuf, &tmpbuf[msg_offset], msg_len, frame_len - msg_offset);
-  err = noise_cipherstate_encrypt(send_cipher_, &mbuf);
-  if (err != 0) {
-    state_ = State::FAILED;
-    HELPER_LOG("noise_cipherstate_encrypt failed: %s", noise_err_to_str(err).c_str());
-    return APIError::CIPHERSTATE_ENCRYPT_FAILED;
+    const size_t frame_len = 3 + mbuf.size;
+    if (buf_start != data + write_pos)
+      std::memmove(data + write_pos, buf_start, frame_len);
+    write_pos += frame_len;
   }
 
-  size_t total_len = 3 + mbuf.size;
-  tmpbuf[1] = (uint8_t)(mbuf.size >> 8);
-  tmpbuf[2] = (uint8_t) mbuf.size;
-
   struct iovec iov;
-  iov.iov_base = &tmpbuf[0];
-  iov.iov_len = total_len;
+  iov.iov_base = data;
+  iov.iov_len = write_pos;
 
   // write raw to not have two packets sent if NAGLE disabled
   return write_raw_(&iov, 1);
@@ -900,23 +914,49 @@ APIError APIPlaintextFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   return APIError::OK;
 }
 bool APIPlaintextFrameHelper::can_write_without_blocking() { return state_ == State::DATA && tx_buf_.empty(); }
-APIError APIPlaintextFrameHelper::write_packet(uint16_t type, const uint8_t *payload, size_t payload_len) {
+APIError APIPlaintextFrameHelper::write_protobuf_packets(ProtoWriteBuffer buffer, const PacketInfo *packets,
+                                                         size_t count) {
   if (state_ != State::DATA) {
     return APIError::BAD_STATE;
   }
+  if (count == 0)
+    return APIError::OK;
 
-  std::vector<uint8_t> header;
-  header.push_back(0x00);
-  ProtoVarInt(payload_len).encode(header);
-  ProtoVarInt(type).encode(header);
+  std::vector<uint8_t> *raw_buffer = buffer.get_buffer();
+  const PacketInfo &last = packets[count - 1];
+  if (last.offset + frame_header_padding_ + last.payload_size > raw_buffer->size())
+    return APIError::BAD_ARG;
+  uint8_t *data = raw_buffer->data();
+
+  size_t write_pos = 0;
+  for (size_t i = 0; i < count; i++) {
+    const PacketInfo &packet = packets[i];
+
+    // indicator, length and type; varints can take up to 10 bytes each
+    uint8_t header[21];
+    uint8_t header_len = 0;
+    header[header_len++] = 0x00;
+    header_len += ProtoVarInt(packet.payload_size).encode_to(&header[header_len]);
+    header_len += ProtoVarInt(packet.message_type).encode_to(&header[header_len]);
+    if (header_len > frame_header_padding_) {
+      HELPER_LOG("Packet too large: %u bytes of type %u", packet.payload_size, packet.message_type);
+      return APIError::BAD_ARG;
+    }
 
-  struct iovec iov[2];
-  iov[0].iov_base = &header[0];
-  iov[0].iov_len = header.size();
-  iov[1].iov_base = const_cast<uint8_t *>(payload);
-  iov[1].iov_len = payload_len;
+    // the header goes right in front of the payload, then the frame is moved behind the previous one
+    uint8_t *frame_start = data + packet.offset + frame_header_padding_ - header_len;
+    std::memcpy(frame_start, header, header_len);
+    const size_t frame_len = header_len + packet.payload_size;
+    if (frame_start != data + write_pos)
+      std::memmove(data + write_pos, frame_start, frame_len);
+    write_pos += frame_len;
+  }
 
-  return write_raw_(iov, 2);
+  struct iovec iov;
+  iov.iov_base = data;
+  iov.iov_len = write_pos;
+
+  return write_raw_(&iov, 1);
 }
 APIError APIPlaintextFrameHelper::try_send_tx_buf_() {
   // try send from tx_buf
@@ -12,6 +12,7 @@
 
 #include "esphome/components/socket/socket.h"
 #include "api_noise_context.h"
+#include "proto.h"
 
 namespace esphome {
 namespace api {
@@ -30,6 +31,14 @@ struct PacketBuffer {
   uint8_t data_len;
 };
 
+/// Location of one encoded message in a buffer holding several, see APIFrameHelper::write_protobuf_packets().
+struct PacketInfo {
+  uint16_t message_type;
+  /// Start of the frame_header_padding() bytes reserved in front of the message.
+  uint32_t offset;
+  uint32_t payload_size;
+};
+
 enum class APIError : int {
   OK = 0,
   WOULD_BLOCK = 1001,
@@ -65,25 +74,55 @@ class APIFrameHelper {
   virtual APIError loop() = 0;
   virtual APIError read_packet(ReadPacketBuffer *buffer) = 0;
   virtual bool can_write_without_blocking() = 0;
-  virtual APIError write_packet(uint16_t type, const uint8_t *data, size_t len) = 0;
+  /// Bytes that were accepted by write_protobuf_packets() but are still waiting for the socket.
+  virtual size_t get_tx_backlog() const = 0;
+  /** Send a message that was encoded into buffer after frame_header_padding() reserved bytes.
+   *
+   * The frame header is filled into the reserved space (and for encrypted frames the MAC is appended), so the
+   * message is sent straight from the buffer it was encoded into.
+   */
+  APIError write_protobuf_packet(uint16_t type, ProtoWriteBuffer buffer) {
+    PacketInfo packet{type, 0, static_cast<uint32_t>(buffer.get_buffer()->size() - this->frame_header_padding_)};
+    return this->write_protobuf_packets(buffer, &packet, 1);
+  }
+  /** Send several messages encoded back to back into buffer with a single write.
+   *
+   * Every message is preceded by frame_header_padding() and followed by frame_footer_size() reserved bytes (the
+   * footer of the last one may be missing). The frames are built in place and moved together before writing.
+   */
+  virtual APIError write_protobuf_packets(ProtoWriteBuffer buffer, const PacketInfo *packets, size_t count) = 0;
   virtual std::string getpeername() = 0;
   virtual APIError close() = 0;
   virtual APIError shutdown(int how) = 0;
   // Give this helper a name for logging
   virtual void set_log_info(std::string info) = 0;
+  /// Number of bytes to reserve in front of a message for the frame header.
+  uint8_t frame_header_padding() const { return this->frame_header_padding_; }
+  /// Number of bytes to reserve after a message for the frame footer.
+  uint8_t frame_footer_size() const { return this->frame_footer_size_; }
+
+ protected:
+  uint8_t frame_header_padding_{0};
+  uint8_t frame_footer_size_{0};
 };
 
 #ifdef USE_API_NOISE
 class APINoiseFrameHelper : public APIFrameHelper {
  public:
   APINoiseFrameHelper(std::unique_ptr<socket::Socket> socket, std::shared_ptr<APINoiseContext> ctx)
-      : socket_(std::move(socket)), ctx_(std::move(std::move(ctx))) {}
+      : socket_(std::move(socket)), ctx_(std::move(std::move(ctx))) {
+    // 3 byte frame header followed by the encrypted 2 byte type and 2 byte length
+    this->frame_header_padding_ = 7;
+    // MAC of the ChaChaPoly cipher
+    this->frame_footer_size_ = 16;
+  }
   ~APINoiseFrameHelper() override;
   APIError init() override;
   APIError loop() override;
   APIError read_packet(ReadPacketBuffer *buffer) override;
   bool can_write_without_blocking() override;
-  APIError write_packet(uint16_t type, const uint8_t *payload, size_t len) override;
+  size_t get_tx_backlog() const override { return tx_buf_.size(); }
+  APIError write_protobuf_packets(ProtoWriteBuffer buffer, const PacketInfo *packets, size_t count) override;
   std::string getpeername() override { return socket_->getpeername(); }
   APIError close() override;
   APIError shutdown(int how) override;
@@ -137,13 +176,17 @@ class APINoiseFrameHelper : public APIFrameHelper {
 #ifdef USE_API_PLAINTEXT
 class APIPlaintextFrameHelper : public APIFrameHelper {
  public:
-  APIPlaintextFrameHelper(std::unique_ptr<socket::Socket> socket) : socket_(std::move(socket)) {}
+  APIPlaintextFrameHelper(std::unique_ptr<socket::Socket> socket) : socket_(std::move(socket)) {
+    // Indicator byte, up to 3 bytes of length varint and up to 2 bytes of type varint
+    this->frame_header_padding_ = 6;
+  }
   ~APIPlaintextFrameHelper() override = default;
   APIError init() override;
   APIError loop() override;
   APIError read_packet(ReadPacketBuffer *buffer) override;
   bool can_write_without_blocking() override;
-  APIError write_packet(uint16_t type, const uint8_t *payload, size_t len) override;
+  size_t get_tx_backlog() const override { return tx_buf_.size(); }
+  APIError write_protobuf_packets(ProtoWriteBuffer buffer, const PacketInfo *packets, size_t count) override;
   std::string getpeername() override { return socket_->getpeername(); }
   APIError close() override;
   APIError shutdown(int how) override;
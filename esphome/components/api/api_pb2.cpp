@@ -349,6 +349,9 @@ bool HelloRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value)
   }
 }
 void HelloRequest::encode(ProtoWriteBuffer buffer) const { buffer.encode_string(1, this->client_info); }
+void HelloRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->client_info);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void HelloRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -393,6 +396,12 @@ void HelloResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(3, this->server_info);
   buffer.encode_string(4, this->name);
 }
+void HelloResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint32(total_size, 1, this->api_version_major);
+  ProtoSize::add_uint32(total_size, 1, this->api_version_minor);
+  ProtoSize::add_string(total_size, 1, this->server_info);
+  ProtoSize::add_string(total_size, 1, this->name);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void HelloResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -428,6 +437,9 @@ bool ConnectRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value
   }
 }
 void ConnectRequest::encode(ProtoWriteBuffer buffer) const { buffer.encode_string(1, this->password); }
+void ConnectRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->password);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ConnectRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -449,6 +461,9 @@ bool ConnectResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   }
 }
 void ConnectResponse::encode(ProtoWriteBuffer buffer) const { buffer.encode_bool(1, this->invalid_password); }
+void ConnectResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_bool(total_size, 1, this->invalid_password);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ConnectResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -460,22 +475,27 @@ void ConnectResponse::dump_to(std::string &out) const {
 }
 #endif
 void DisconnectRequest::encode(ProtoWriteBuffer buffer) const {}
+void DisconnectRequest::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void DisconnectRequest::dump_to(std::string &out) const { out.append("DisconnectRequest {}"); }
 #endif
 void DisconnectResponse::encode(ProtoWriteBuffer buffer) const {}
+void DisconnectResponse::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void DisconnectResponse::dump_to(std::string &out) const { out.append("DisconnectResponse {}"); }
 #endif
 void PingRequest::encode(ProtoWriteBuffer buffer) const {}
+void PingRequest::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void PingRequest::dump_to(std::string &out) const { out.append("PingRequest {}"); }
 #endif
 void PingResponse::encode(ProtoWriteBuffer buffer) const {}
+void PingResponse::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void PingResponse::dump_to(std::string &out) const { out.append("PingResponse {}"); }
 #endif
 void DeviceInfoRequest::encode(ProtoWriteBuffer buffer) const {}
+void DeviceInfoRequest::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void DeviceInfoRequest::dump_to(std::string &out) const { out.append("DeviceInfoRequest {}"); }
 #endif
@@ -543,6 +563,18 @@ void DeviceInfoResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(9, this->project_version);
   buffer.encode_uint32(10, this->webserver_port);
 }
+void DeviceInfoResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_bool(total_size, 1, this->uses_password);
+  ProtoSize::add_string(total_size, 1, this->name);
+  ProtoSize::add_string(total_size, 1, this->mac_address);
+  ProtoSize::add_string(total_size, 1, this->esphome_version);
+  ProtoSize::add_string(total_size, 1, this->compilation_time);
+  ProtoSize::add_string(total_size, 1, this->model);
+  ProtoSize::add_bool(total_size, 1, this->has_deep_sleep);
+  ProtoSize::add_string(total_size, 1, this->project_name);
+  ProtoSize::add_string(total_size, 1, this->project_version);
+  ProtoSize::add_uint32(total_size, 1, this->webserver_port);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void DeviceInfoResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -591,14 +623,17 @@ void DeviceInfoResponse::dump_to(std::string &out) const {
 }
 #endif
 void ListEntitiesRequest::encode(ProtoWriteBuffer buffer) const {}
+void ListEntitiesRequest::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesRequest::dump_to(std::string &out) const { out.append("ListEntitiesRequest {}"); }
 #endif
 void ListEntitiesDoneResponse::encode(ProtoWriteBuffer buffer) const {}
+void ListEntitiesDoneResponse::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesDoneResponse::dump_to(std::string &out) const { out.append("ListEntitiesDoneResponse {}"); }
 #endif
 void SubscribeStatesRequest::encode(ProtoWriteBuffer buffer) const {}
+void SubscribeStatesRequest::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SubscribeStatesRequest::dump_to(std::string &out) const { out.append("SubscribeStatesRequest {}"); }
 #endif
@@ -667,6 +702,17 @@ void ListEntitiesBinarySensorResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(8, this->icon);
   buffer.encode_enum<enums::EntityCategory>(9, this->entity_category);
 }
+void ListEntitiesBinarySensorResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 1, this->name);
+  ProtoSize::add_string(total_size, 1, this->unique_id);
+  ProtoSize::add_string(total_size, 1, this->device_class);
+  ProtoSize::add_bool(total_size, 1, this->is_status_binary_sensor);
+  ProtoSize::add_bool(total_size, 1, this->disabled_by_default);
+  ProtoSize::add_string(total_size, 1, this->icon);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 1, this->entity_category);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesBinarySensorResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -739,6 +785,11 @@ void BinarySensorStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(2, this->state);
   buffer.encode_bool(3, this->missing_state);
 }
+void BinarySensorStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 1, this->state);
+  ProtoSize::add_bool(total_size, 1, this->missing_state);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BinarySensorStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -833,6 +884,19 @@ void ListEntitiesCoverResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(10, this->icon);
   buffer.encode_enum<enums::EntityCategory>(11, this->entity_category);
 }
+void ListEntitiesCoverResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 1, this->name);
+  ProtoSize::add_string(total_size, 1, this->unique_id);
+  ProtoSize::add_bool(total_size, 1, this->assumed_state);
+  ProtoSize::add_bool(total_size, 1, this->supports_position);
+  ProtoSize::add_bool(total_size, 1, this->supports_tilt);
+  ProtoSize::add_string(total_size, 1, this->device_class);
+  ProtoSize::add_bool(total_size, 1, this->disabled_by_default);
+  ProtoSize::add_string(total_size, 1, this->icon);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 1, this->entity_category);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesCoverResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -923,6 +987,13 @@ void CoverStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_float(4, this->tilt);
   buffer.encode_enum<enums::CoverOperation>(5, this->current_operation);
 }
+void CoverStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_enum<enums::LegacyCoverState>(total_size, 1, this->legacy_state);
+  ProtoSize::add_float(total_size, 1, this->position);
+  ProtoSize::add_float(total_size, 1, this->tilt);
+  ProtoSize::add_enum<enums::CoverOperation>(total_size, 1, this->current_operation);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void CoverStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -1006,6 +1077,16 @@ void CoverCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_float(7, this->tilt);
   buffer.encode_bool(8, this->stop);
 }
+void CoverCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 1, this->has_legacy_command);
+  ProtoSize::add_enum<enums::LegacyCoverCommand>(total_size, 1, this->legacy_command);
+  ProtoSize::add_bool(total_size, 1, this->has_position);
+  ProtoSize::add_float(total_size, 1, this->position);
+  ProtoSize::add_bool(total_size, 1, this->has_tilt);
+  ProtoSize::add_float(total_size, 1, this->tilt);
+  ProtoSize::add_bool(total_size, 1, this->stop);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void CoverCommandRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -1122,6 +1203,19 @@ void ListEntitiesFanResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(10, this->icon);
   buffer.encode_enum<enums::EntityCategory>(11, this->entity_category);
 }
+void ListEntitiesFanResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 1, this->name);
+  ProtoSize::add_string(total_size, 1, this->unique_id);
+  ProtoSize::add_bool(total_size, 1, this->supports_oscillation);
+  ProtoSize::add_bool(total_size, 1, this->supports_speed);
+  ProtoSize::add_bool(total_size, 1, this->supports_direction);
+  ProtoSize::add_int32(total_size, 1, this->supported_speed_count);
+  ProtoSize::add_bool(total_size, 1, this->disabled_by_default);
+  ProtoSize::add_string(total_size, 1, this->icon);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 1, this->entity_category);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesFanResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -1218,6 +1312,14 @@ void FanStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::FanDirection>(5, this->direction);
   buffer.encode_int32(6, this->speed_level);
 }
+void FanStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 1, this->state);
+  ProtoSize::add_bool(total_size, 1, this->oscillating);
+  ProtoSize::add_enum<enums::FanSpeed>(total_size, 1, this->speed);
+  ProtoSize::add_enum<enums::FanDirection>(total_size, 1, this->direction);
+  ProtoSize::add_int32(total_size, 1, this->speed_level);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void FanStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -1319,6 +1421,19 @@ void FanCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(10, this->has_speed_level);
   buffer.encode_int32(11, this->speed_level);
 }
+void FanCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 1, this->has_state);
+  ProtoSize::add_bool(total_size, 1, this->state);
+  ProtoSize::add_bool(total_size, 1, this->has_speed);
+  ProtoSize::add_enum<enums::FanSpeed>(total_size, 1, this->speed);
+  ProtoSize::add_bool(total_size, 1, this->has_oscillating);
+  ProtoSize::add_bool(total_size, 1, this->oscillating);
+  ProtoSize::add_bool(total_size, 1, this->has_direction);
+  ProtoSize::add_enum<enums::FanDirection>(total_size, 1, this->direction);
+  ProtoSize::add_bool(total_size, 1, this->has_speed_level);
+  ProtoSize::add_int32(total_size, 1, this->speed_level);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void FanCommandRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -1470,6 +1585,27 @@ void ListEntitiesLightResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(14, this->icon);
   buffer.encode_enum<enums::EntityCategory>(15, this->entity_category);
 }
+void ListEntitiesLightResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 1, this->name);
+  ProtoSize::add_string(total_size, 1, this->unique_id);
+  for (auto &it : this->supported_color_modes) {
+    ProtoSize::add_enum<enums::ColorMode>(total_size, 1, it, true);
+  }
+  ProtoSize::add_bool(total_size, 1, this->legacy_supports_brightness);
+  ProtoSize::add_bool(total_size, 1, this->legacy_supports_rgb);
+  ProtoSize::add_bool(total_size, 1, this->legacy_supports_white_value);
+  ProtoSize::add_bool(total_size, 1, this->legacy_supports_color_temperature);
+  ProtoSize::add_float(total_size, 1, this->min_mireds);
+  ProtoSize::add_float(total_size, 1, this->max_mireds);
+  for (auto &it : this->effects) {
+    ProtoSize::add_string(total_size, 1, it, true);
+  }
+  ProtoSize::add_bool(total_size, 1, this->disabled_by_default);
+  ProtoSize::add_string(total_size, 1, this->icon);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 1, this->entity_category);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesLightResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -1628,6 +1764,21 @@ void LightStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_float(13, this->warm_white);
   buffer.encode_string(9, this->effect);
 }
+void LightStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 1, this->state);
+  ProtoSize::add_float(total_size, 1, this->brightness);
+  ProtoSize::add_enum<enums::ColorMode>(total_size, 1, this->color_mode);
+  ProtoSize::add_float(total_size, 1, this->color_brightness);
+  ProtoSize::add_float(total_size, 1, this->red);
+  ProtoSize::add_float(total_size, 1, this->green);
+  ProtoSize::add_float(total_size, 1, this->blue);
+  ProtoSize::add_float(total_size, 1, this->white);
+  ProtoSize::add_float(total_size, 1, this->color_temperature);
+  ProtoSize::add_float(total_size, 1, this->cold_white);
+  ProtoSize::add_float(total_size, 1, this->warm_white);
+  ProtoSize::add_string(total_size, 1, this->effect);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void LightStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -1851,6 +2002,35 @@ void LightCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(18, this->has_effect);
   buffer.encode_string(19, this->effect);
 }
+void LightCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 1, this->has_state);
+  ProtoSize::add_bool(total_size, 1, this->state);
+  ProtoSize::add_bool(total_size, 1, this->has_brightness);
+  ProtoSize::add_float(total_size, 1, this->brightness);
+  ProtoSize::add_bool(total_size, 2, this->has_color_mode);
+  ProtoSize::add_enum<enums::ColorMode>(total_size, 2, this->color_mode);
+  ProtoSize::add_bool(total_size, 2, this->has_color_brightness);
+  ProtoSize::add_float(total_size, 2, this->color_brightness);
+  ProtoSize::add_bool(total_size, 1, this->has_rgb);
+  ProtoSize::add_float(total_size, 1, this->red);
+  ProtoSize::add_float(total_size, 1, this->green);
+  ProtoSize::add_float(total_size, 1, this->blue);
+  ProtoSize::add_bool(total_size, 1, this->has_white);
+  ProtoSize::add_float(total_size, 1, this->white);
+  ProtoSize::add_bool(total_size, 1, this->has_color_temperature);
+  ProtoSize::add_float(total_size, 1, this->color_temperature);
+  ProtoSize::add_bool(total_size, 2, this->has_cold_white);
+  ProtoSize::add_float(total_size, 2, this->cold_white);
+  ProtoSize::add_bool(total_size, 2, this->has_warm_white);
+  ProtoSize::add_float(total_size, 2, this->warm_white);
+  ProtoSize::add_bool(total_size, 1, this->has_transition_length);
+  ProtoSize::add_uint32(total_size, 1, this->transition_length);
+  ProtoSize::add_bool(total_size, 2, this->has_flash_length);
+  ProtoSize::add_uint32(total_size, 2, this->flash_length);
+  ProtoSize::add_bool(total_size, 2, this->has_effect);
+  ProtoSize::add_string(total_size, 2, this->effect);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void LightCommandRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2062,6 +2242,21 @@ void ListEntitiesSensorResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(12, this->disabled_by_default);
   buffer.encode_enum<enums::EntityCategory>(13, this->entity_category);
 }
+void ListEntitiesSensorResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 1, this->name);
+  ProtoSize::add_string(total_size, 1, this->unique_id);
+  ProtoSize::add_string(total_size, 1, this->icon);
+  ProtoSize::add_string(total_size, 1, this->unit_of_measurement);
+  ProtoSize::add_int32(total_size, 1, this->accuracy_decimals);
+  ProtoSize::add_bool(total_size, 1, this->force_update);
+  ProtoSize::add_string(total_size, 1, this->device_class);
+  ProtoSize::add_enum<enums::SensorStateClass>(total_size, 1, this->state_class);
+  ProtoSize::add_enum<enums::SensorLastResetType>(total_size, 1, this->legacy_last_reset_type);
+  ProtoSize::add_bool(total_size, 1, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 1, this->entity_category);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesSensorResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2151,6 +2346,11 @@ void SensorStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_float(2, this->state);
   buffer.encode_bool(3, this->missing_state);
 }
+void SensorStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_float(total_size, 1, this->state);
+  ProtoSize::add_bool(total_size, 1, this->missing_state);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SensorStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2236,6 +2436,17 @@ void ListEntitiesSwitchResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::EntityCategory>(8, this->entity_category);
   buffer.encode_string(9, this->device_class);
 }
+void ListEntitiesSwitchResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 1, this->name);
+  ProtoSize::add_string(total_size, 1, this->unique_id);
+  ProtoSize::add_string(total_size, 1, this->icon);
+  ProtoSize::add_bool(total_size, 1, this->assumed_state);
+  ProtoSize::add_bool(total_size, 1, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 1, this->entity_category);
+  ProtoSize::add_string(total_size, 1, this->device_class);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesSwitchResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2303,6 +2514,10 @@ void SwitchStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_bool(2, this->state);
 }
+void SwitchStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 1, this->state);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SwitchStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2342,6 +2557,10 @@ void SwitchCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_bool(2, this->state);
 }
+void SwitchCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 1, this->state);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SwitchCommandRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2412,6 +2631,15 @@ void ListEntitiesTextSensorResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(6, this->disabled_by_default);
   buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
 }
+void ListEntitiesTextSensorResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 1, this->name);
+  ProtoSize::add_string(total_size, 1, this->unique_id);
+  ProtoSize::add_string(total_size, 1, this->icon);
+  ProtoSize::add_bool(total_size, 1, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 1, this->entity_category);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesTextSensorResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2482,6 +2710,11 @@ void TextSensorStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(2, this->state);
   buffer.encode_bool(3, this->missing_state);
 }
+void TextSensorStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 1, this->state);
+  ProtoSize::add_bool(total_size, 1, this->missing_state);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void TextSensorStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2519,6 +2752,10 @@ void SubscribeLogsRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::LogLevel>(1, this->level);
   buffer.encode_bool(2, this->dump_config);
 }
+void SubscribeLogsRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_enum<enums::LogLevel>(total_size, 1, this->level);
+  ProtoSize::add_bool(total_size, 1, this->dump_config);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SubscribeLogsRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2562,6 +2799,11 @@ void SubscribeLogsResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(3, this->message);
   buffer.encode_bool(4, this->send_failed);
 }
+void SubscribeLogsResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_enum<enums::LogLevel>(total_size, 1, this->level);
+  ProtoSize::add_string(total_size, 1, this->message);
+  ProtoSize::add_bool(total_size, 1, this->send_failed);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SubscribeLogsResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2581,6 +2823,7 @@ void SubscribeLogsResponse::dump_to(std::string &out) const {
 }
 #endif
 void SubscribeHomeassistantServicesRequest::encode(ProtoWriteBuffer buffer) const {}
+void SubscribeHomeassistantServicesRequest::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SubscribeHomeassistantServicesRequest::dump_to(std::string &out) const {
   out.append("SubscribeHomeassistantServicesRequest {}");
@@ -2604,6 +2847,10 @@ void HomeassistantServiceMap::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(1, this->key);
   buffer.encode_string(2, this->value);
 }
+void HomeassistantServiceMap::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 1, this->value);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void HomeassistantServiceMap::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2663,6 +2910,19 @@ void HomeassistantServiceResponse::encode(ProtoWriteBuffer buffer) const {
   }
   buffer.encode_bool(5, this->is_event);
 }
+void HomeassistantServiceResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->service);
+  for (auto &it : this->data) {
+    ProtoSize::add_message<HomeassistantServiceMap>(total_size, 1, it, true);
+  }
+  for (auto &it : this->data_template) {
+    ProtoSize::add_message<HomeassistantServiceMap>(total_size, 1, it, true);
+  }
+  for (auto &it : this->variables) {
+    ProtoSize::add_message<HomeassistantServiceMap>(total_size, 1, it, true);
+  }
+  ProtoSize::add_bool(total_size, 1, this->is_event);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void HomeassistantServiceResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2696,6 +2956,7 @@ void HomeassistantServiceResponse::dump_to(std::string &out) const {
 }
 #endif
 void SubscribeHomeAssistantStatesRequest::encode(ProtoWriteBuffer buffer) const {}
+void SubscribeHomeAssistantStatesRequest::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SubscribeHomeAssistantStatesRequest::dump_to(std::string &out) const {
   out.append("SubscribeHomeAssistantStatesRequest {}");
@@ -2719,6 +2980,10 @@ void SubscribeHomeAssistantStateResponse::encode(ProtoWriteBuffer buffer) const
   buffer.encode_string(1, this->entity_id);
   buffer.encode_string(2, this->attribute);
 }
+void SubscribeHomeAssistantStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->entity_id);
+  ProtoSize::add_string(total_size, 1, this->attribute);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SubscribeHomeAssistantStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2756,6 +3021,11 @@ void HomeAssistantStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(2, this->state);
   buffer.encode_string(3, this->attribute);
 }
+void HomeAssistantStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->entity_id);
+  ProtoSize::add_string(total_size, 1, this->state);
+  ProtoSize::add_string(total_size, 1, this->attribute);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void HomeAssistantStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2775,6 +3045,7 @@ void HomeAssistantStateResponse::dump_to(std::string &out) const {
 }
 #endif
 void GetTimeRequest::encode(ProtoWriteBuffer buffer) const {}
+void GetTimeRequest::calculate_size(uint32_t &total_size) const {}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void GetTimeRequest::dump_to(std::string &out) const { out.append("GetTimeRequest {}"); }
 #endif
@@ -2789,6 +3060,9 @@ bool GetTimeResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
   }
 }
 void GetTimeResponse::encode(ProtoWriteBuffer buffer) const { buffer.encode_fixed32(1, this->epoch_seconds); }
+void GetTimeResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->epoch_seconds);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void GetTimeResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2824,6 +3098,10 @@ void ListEntitiesServicesArgument::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(1, this->name);
   buffer.encode_enum<enums::ServiceArgType>(2, this->type);
 }
+void ListEntitiesServicesArgument::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->name);
+  ProtoSize::add_enum<enums::ServiceArgType>(total_size, 1, this->type);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesServicesArgument::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2869,6 +3147,13 @@ void ListEntitiesServicesResponse::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_message<ListEntitiesServicesArgument>(3, it, true);
   }
 }
+void ListEntitiesServicesResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->name);
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  for (auto &it : this->args) {
+    ProtoSize::add_message<ListEntitiesServicesArgument>(total_size, 1, it, true);
+  }
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesServicesResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2963,6 +3248,25 @@ void ExecuteServiceArgument::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_string(9, it, true);
   }
 }
+void ExecuteServiceArgument::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_bool(total_size, 1, this->bool_);
+  ProtoSize::add_int32(total_size, 1, this->legacy_int);
+  ProtoSize::add_float(total_size, 1, this->float_);
+  ProtoSize::add_string(total_size, 1, this->string_);
+  ProtoSize::add_sint32(total_size, 1, this->int_);
+  for (auto it : this->bool_array) {
+    ProtoSize::add_bool(total_size, 1, it, true);
+  }
+  for (auto &it : this->int_array) {
+    ProtoSize::add_sint32(total_size, 1, it, true);
+  }
+  for (auto &it : this->float_array) {
+    ProtoSize::add_float(total_size, 1, it, true);
+  }
+  for (auto &it : this->string_array) {
+    ProtoSize::add_string(total_size, 1, it, true);
+  }
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ExecuteServiceArgument::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -3044,6 +3348,12 @@ void ExecuteServiceRequest::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_message<ExecuteServiceArgument>(2, it, true);
   }
 }
+void ExecuteServiceRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  for (auto &it : this->args) {
+    ProtoSize::add_message<ExecuteServiceArgument>(total_size, 1, it, true);
+  }
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ExecuteServiceRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -3116,6 +3426,15 @@ void ListEntitiesCameraResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(6, this->icon);
   buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
 }
+void ListEntitiesCameraResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 1, this->name);
+  ProtoSize::add_string(total_size, 1, this->unique_id);
+  ProtoSize::add_bool(total_size, 1, this->disabled_by_default);
+  ProtoSize::add_string(total_size, 1, this->icon);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 1, this->entity_category);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesCameraResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -3186,6 +3505,11 @@ void CameraImageResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(2, this->data);
   buffer.encode_bool(3, this->done);
 }
+void CameraImageResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 1, this->data);
+  ProtoSize::add_bool(total_size, 1, this->done);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void CameraImageResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -3223,6 +3547,10 @@ void CameraImageRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(1, this->single);
   buffer.encode_bool(2, this->stream);
 }
+void CameraImageRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_bool(total_size, 1, this->single);
+  ProtoSize::add_bool(total_size, 1, this->stream);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void CameraImageRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -3369,6 +3697,40 @@ void ListEntitiesClimateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(19, this->icon);
   buffer.encode_enum<enums::EntityCategory>(20, this->entity_category);
 }
+void ListEntitiesClimateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 1, this->name);
+  ProtoSize::add_string(total_size, 1, this->unique_id);
+  ProtoSize::add_bool(total_size, 1, this->supports_current_temperature);
+  ProtoSize::add_bool(total_size, 1, this->supports_two_point_target_temperature);
+  for (auto &it : this->supported_modes) {
+    ProtoSize::add_enum<enums::ClimateMode>(total_size, 1, it, true);
+  }
+  ProtoSize::add_float(total_size, 1, this->visual_min_temperature);
+  ProtoSize::add_float(total_size, 1, this->visual_max_temperature);
+  ProtoSize::add_float(total_size, 1, this->visual_temperature_step);
+  ProtoSize::add_bool(total_size, 1, this->legacy_supports_away);
+  ProtoSize::add_bool(total_size, 1, this->supports_action);
+  for (auto &it : this->supported_fan_modes) {
+    ProtoSize::add_enum<enums::ClimateFanMode>(total_size, 1, it, true);
+  }
+  for (auto &it : this->supported_swing_modes) {
+    ProtoSize::add_enum<enums::ClimateSwingMode>(total_size, 1, it, true);
+  }
+  for (auto &it : this->supported_custom_fan_modes) {
+    ProtoSize::add_string(total_size, 1, it, true);
+  }
+  for (auto &it : this->supported_presets) {
+    ProtoSize::add_enum<enums::ClimatePreset>(total_size, 2, it, true);
+  }
+  for (auto &it : this->supported_custom_presets) {
+    ProtoSize::add_string(total_size, 2, it, true);
+  }
+  ProtoSize::add_bool(total_size, 2, this->disabled_by_default);
+  ProtoSize::add_string(total_size, 2, this->icon);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 2, this->entity_category);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesClimateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -3556,6 +3918,21 @@ void ClimateStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::ClimatePreset>(12, this->preset);
   buffer.encode_string(13, this->custom_preset);
 }
+void ClimateStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_enum<enums::ClimateMode>(total_size, 1, this->mode);
+  ProtoSize::add_float(total_size, 1, this->current_temperature);
+  ProtoSize::add_float(total_size, 1, this->target_temperature);
+  ProtoSize::add_float(total_size, 1, this->target_temperature_low);
+  ProtoSize::add_float(total_size, 1, this->target_temperature_high);
+  ProtoSize::add_bool(total_size, 1, this->legacy_away);
+  ProtoSize::add_enum<enums::ClimateAction>(total_size, 1, this->action);
+  ProtoSize::add_enum<enums::ClimateFanMode>(total_size, 1, this->fan_mode);
+  ProtoSize::add_enum<enums::ClimateSwingMode>(total_size, 1, this->swing_mode);
+  ProtoSize::add_string(total_size, 1, this->custom_fan_mode);
+  ProtoSize::add_enum<enums::ClimatePreset>(total_size, 1, this->preset);
+  ProtoSize::add_string(total_size, 1, this->custom_preset);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ClimateStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -3744,6 +4121,29 @@ void ClimateCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(20, this->has_custom_preset);
   buffer.encode_string(21, this->custom_preset);
 }
+void ClimateCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 1, this->has_mode);
+  ProtoSize::add_enum<enums::ClimateMode>(total_size, 1, this->mode);
+  ProtoSize::add_bool(total_size, 1, this->has_target_temperature);
+  ProtoSize::add_float(total_size, 1, this->target_temperature);
+  ProtoSize::add_bool(total_size, 1, this->has_target_temperature_low);
+  ProtoSize::add_float(total_size, 1, this->target_temperature_low);
+  ProtoSize::add_bool(total_size, 1, this->has_target_temperature_high);
+  ProtoSize::add_float(total_size, 1, this->target_temperature_high);
+  ProtoSize::add_bool(total_size, 1, this->has_legacy_away);
+  ProtoSize::add_bool(total_size, 1, this->legacy_away);
+  ProtoSize::add_bool(total_size, 1, this->has_fan_mode);
+  ProtoSize::add_enum<enums::ClimateFanMode>(total_size, 1, this->fan_mode);
+  ProtoSize::add_bool(total_size, 1, this->has_swing_mode);
+  ProtoSize::add_enum<enums::ClimateSwingMode>(total_size, 1, this->swing_mode);
+  ProtoSize::add_bool(total_size, 2, this->has_custom_fan_mode);
+  ProtoSize::add_string(total_size, 2, this->custom_fan_mode);
+  ProtoSize::add_bool(total_size, 2, this->has_preset);
+  ProtoSize::add_enum<enums::ClimatePreset>(total_size, 2, this->preset);
+  ProtoSize::add_bool(total_size, 2, this->has_custom_preset);
+  ProtoSize::add_string(total_size, 2, this->custom_preset);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ClimateCommandRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -3918,6 +4318,20 @@ void ListEntitiesNumberResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(11, this->unit_of_measurement);
   buffer.encode_enum<enums::NumberMode>(12, this->mode);
 }
+void ListEntitiesNumberResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 1, this->name);
+  ProtoSize::add_string(total_size, 1, this->unique_id);
+  ProtoSize::add_string(total_size, 1, this->icon);
+  ProtoSize::add_float(total_size, 1, this->min_value);
+  ProtoSize::add_float(total_size, 1, this->max_value);
+  ProtoSize::add_float(total_size, 1, this->step);
+  ProtoSize::add_bool(total_size, 1, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 1, this->entity_category);
+  ProtoSize::add_string(total_size, 1, this->unit_of_measurement);
+  ProtoSize::add_enum<enums::NumberMode>(total_size, 1, this->mode);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesNumberResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4005,6 +4419,11 @@ void NumberStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_float(2, this->state);
   buffer.encode_bool(3, this->missing_state);
 }
+void NumberStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_float(total_size, 1, this->state);
+  ProtoSize::add_bool(total_size, 1, this->missing_state);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void NumberStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4043,6 +4462,10 @@ void NumberCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_float(2, this->state);
 }
+void NumberCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_float(total_size, 1, this->state);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void NumberCommandRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4121,6 +4544,18 @@ void ListEntitiesSelectResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(7, this->disabled_by_default);
   buffer.encode_enum<enums::EntityCategory>(8, this->entity_category);
 }
+void ListEntitiesSelectResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 1, this->name);
+  ProtoSize::add_string(total_size, 1, this->unique_id);
+  ProtoSize::add_string(total_size, 1, this->icon);
+  for (auto &it : this->options) {
+    ProtoSize::add_string(total_size, 1, it, true);
+  }
+  ProtoSize::add_bool(total_size, 1, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 1, this->entity_category);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesSelectResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4197,6 +4632,11 @@ void SelectStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(2, this->state);
   buffer.encode_bool(3, this->missing_state);
 }
+void SelectStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 1, this->state);
+  ProtoSize::add_bool(total_size, 1, this->missing_state);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SelectStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4240,6 +4680,10 @@ void SelectCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_string(2, this->state);
 }
+void SelectCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 1, this->state);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SelectCommandRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4330,6 +4774,19 @@ void ListEntitiesLockResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(10, this->requires_code);
   buffer.encode_string(11, this->code_format);
 }
+void ListEntitiesLockResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 1, this->name);
+  ProtoSize::add_string(total_size, 1, this->unique_id);
+  ProtoSize::add_string(total_size, 1, this->icon);
+  ProtoSize::add_bool(total_size, 1, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 1, this->entity_category);
+  ProtoSize::add_bool(total_size, 1, this->assumed_state);
+  ProtoSize::add_bool(total_size, 1, this->supports_open);
+  ProtoSize::add_bool(total_size, 1, this->requires_code);
+  ProtoSize::add_string(total_size, 1, this->code_format);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesLockResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4405,6 +4862,10 @@ void LockStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_enum<enums::LockState>(2, this->state);
 }
+void LockStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_enum<enums::LockState>(total_size, 1, this->state);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void LockStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4460,6 +4921,12 @@ void LockCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(3, this->has_code);
   buffer.encode_string(4, this->code);
 }
+void LockCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_enum<enums::LockCommand>(total_size, 1, this->command);
+  ProtoSize::add_bool(total_size, 1, this->has_code);
+  ProtoSize::add_string(total_size, 1, this->code);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void LockCommandRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4543,6 +5010,16 @@ void ListEntitiesButtonResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
   buffer.encode_string(8, this->device_class);
 }
+void ListEntitiesButtonResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 1, this->name);
+  ProtoSize::add_string(total_size, 1, this->unique_id);
+  ProtoSize::add_string(total_size, 1, this->icon);
+  ProtoSize::add_bool(total_size, 1, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 1, this->entity_category);
+  ProtoSize::add_string(total_size, 1, this->device_class);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesButtonResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4593,6 +5070,9 @@ bool ButtonCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
   }
 }
 void ButtonCommandRequest::encode(ProtoWriteBuffer buffer) const { buffer.encode_fixed32(1, this->key); }
+void ButtonCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ButtonCommandRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4664,6 +5144,16 @@ void ListEntitiesMediaPlayerResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
   buffer.encode_bool(8, this->supports_pause);
 }
+void ListEntitiesMediaPlayerResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string(total_size, 1, this->object_id);
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_string(total_size, 1, this->name);
+  ProtoSize::add_string(total_size, 1, this->unique_id);
+  ProtoSize::add_string(total_size, 1, this->icon);
+  ProtoSize::add_bool(total_size, 1, this->disabled_by_default);
+  ProtoSize::add_enum<enums::EntityCategory>(total_size, 1, this->entity_category);
+  ProtoSize::add_bool(total_size, 1, this->supports_pause);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesMediaPlayerResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4737,6 +5227,12 @@ void MediaPlayerStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_float(3, this->volume);
   buffer.encode_bool(4, this->muted);
 }
+void MediaPlayerStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_enum<enums::MediaPlayerState>(total_size, 1, this->state);
+  ProtoSize::add_float(total_size, 1, this->volume);
+  ProtoSize::add_bool(total_size, 1, this->muted);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void MediaPlayerStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4816,6 +5312,15 @@ void MediaPlayerCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(6, this->has_media_url);
   buffer.encode_string(7, this->media_url);
 }
+void MediaPlayerCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32(total_size, 1, this->key);
+  ProtoSize::add_bool(total_size, 1, this->has_command);
+  ProtoSize::add_enum<enums::MediaPlayerCommand>(total_size, 1, this->command);
+  ProtoSize::add_bool(total_size, 1, this->has_volume);
+  ProtoSize::add_float(total_size, 1, this->volume);
+  ProtoSize::add_bool(total_size, 1, this->has_media_url);
+  ProtoSize::add_string(total_size, 1, this->media_url);
+}
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void MediaPlayerCommandRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -112,6 +112,10 @@ void APIServer::loop() {
   // print disconnection messages
   for (auto it = new_end; it != this->clients_.end(); ++it) {
     ESP_LOGV(TAG, "Removing connection to %s", (*it)->client_info_.c_str());
+    if ((*it)->get_dropped_messages() != 0 || (*it)->get_coalesced_states() != 0) {
+      ESP_LOGD(TAG, "%s: %u messages dropped, %u states coalesced while the socket was busy",
+               (*it)->client_info_.c_str(), (*it)->get_dropped_messages(), (*it)->get_coalesced_states());
+    }
   }
   // resize vector
   this->clients_.erase(new_end, this->clients_.end());
@@ -137,6 +141,9 @@ void APIServer::loop() {
 void APIServer::dump_config() {
   ESP_LOGCONFIG(TAG, "API Server:");
   ESP_LOGCONFIG(TAG, "  Address: %s:%u", network::get_use_address().c_str(), this->port_);
+  if (this->batch_delay_ != 0) {
+    ESP_LOGCONFIG(TAG, "  State batch delay: %ums", this->batch_delay_);
+  }
 #ifdef USE_API_NOISE
   ESP_LOGCONFIG(TAG, "  Using noise encryption: YES");
 #else
@@ -70,20 +70,19 @@ class ProtoVarInt {
     }
   }
   void encode(std::vector<uint8_t> &out) {
-    uint32_t val = this->value_;
-    if (val <= 0x7F) {
-      out.push_back(val);
-      return;
-    }
-    while (val) {
-      uint8_t temp = val & 0x7F;
+    uint8_t data[10];
+    out.insert(out.end(), data, data + this->encode_to(data));
+  }
+  /// Encode into data, which must have room for 10 bytes. Returns the number of bytes written.
+  uint8_t encode_to(uint8_t *data) const {
+    uint64_t val = this->value_;
+    uint8_t len = 0;
+    while (val > 0x7F) {
+      data[len++] = uint8_t(val) | 0x80;
       val >>= 7;
-      if (val) {
-        out.push_back(temp | 0x80);
-      } else {
-        out.push_back(temp);
-      }
     }
+    data[len++] = uint8_t(val);
+    return len;
   }
 
  protected:
@@ -145,8 +144,15 @@ class ProtoWriteBuffer {
  public:
   ProtoWriteBuffer(std::vector<uint8_t> *buffer) : buffer_(buffer) {}
   void write(uint8_t value) { this->buffer_->push_back(value); }
+  void write(const uint8_t *data, size_t len) { this->buffer_->insert(this->buffer_->end(), data, data + len); }
   void encode_varint_raw(ProtoVarInt value) { value.encode(*this->buffer_); }
-  void encode_varint_raw(uint32_t value) { this->encode_varint_raw(ProtoVarInt(value)); }
+  void encode_varint_raw(uint32_t value) {
+    if (value <= 0x7F) {
+      this->write(value);
+      return;
+    }
+    this->encode_varint_raw(ProtoVarInt(value));
+  }
   void encode_field_raw(uint32_t field_id, uint32_t type) {
     uint32_t val = (field_id << 3) | (type & 0b111);
     this->encode_varint_raw(val);
@@ -157,12 +163,10 @@ class ProtoWriteBuffer {
 
     this->encode_field_raw(field_id, 2);
     this->encode_varint_raw(len);
-    auto *data = reinterpret_cast<const uint8_t *>(string);
-    for (size_t i = 0; i < len; i++)
-      this->write(data[i]);
+    this->write(reinterpret_cast<const uint8_t *>(string), len);
   }
   void encode_string(uint32_t field_id, const std::string &value, bool force = false) {
-    this->encode_string(field_id, value.data(), value.size());
+    this->encode_string(field_id, value.data(), value.size(), force);
   }
   void encode_bytes(uint32_t field_id, const uint8_t *data, size_t len, bool force = false) {
     this->encode_string(field_id, reinterpret_cast<const char *>(data), len, force);
@@ -190,24 +194,17 @@ class ProtoWriteBuffer {
       return;
 
     this->encode_field_raw(field_id, 5);
-    this->write((value >> 0) & 0xFF);
-    this->write((value >> 8) & 0xFF);
-    this->write((value >> 16) & 0xFF);
-    this->write((value >> 24) & 0xFF);
+    const uint8_t data[4] = {uint8_t(value), uint8_t(value >> 8), uint8_t(value >> 16), uint8_t(value >> 24)};
+    this->write(data, sizeof(data));
   }
   void encode_fixed64(uint32_t field_id, uint64_t value, bool force = false) {
     if (value == 0 && !force)
       return;
 
-    this->encode_field_raw(field_id, 5);
-    this->write((value >> 0) & 0xFF);
-    this->write((value >> 8) & 0xFF);
-    this->write((value >> 16) & 0xFF);
-    this->write((value >> 24) & 0xFF);
-    this->write((value >> 32) & 0xFF);
-    this->write((value >> 40) & 0xFF);
-    this->write((value >> 48) & 0xFF);
-    this->write((value >> 56) & 0xFF);
+    this->encode_field_raw(field_id, 1);
+    const uint8_t data[8] = {uint8_t(value),       uint8_t(value >> 8),  uint8_t(value >> 16), uint8_t(value >> 24),
+                             uint8_t(value >> 32), uint8_t(value >> 40), uint8_t(value >> 48), uint8_t(value >> 56)};
+    this->write(data, sizeof(data));
   }
   template<typename T> void encode_enum(uint32_t field_id, T value, bool force = false) {
     this->encode_uint32(field_id, static_cast<uint32_t>(value), force);
@@ -221,7 +218,24 @@ class ProtoWriteBuffer {
       uint32_t raw;
     } val{};
     val.value = value;
-    this->encode_fixed32(field_id, val.raw);
+    this->encode_fixed32(field_id, val.raw, force);
+  }
+  void encode_double(uint32_t field_id, double value, bool force = false) {
+    if (value == 0.0 && !force)
+      return;
+
+    union {
+      double value;
+      uint64_t raw;
+    } val{};
+    val.value = value;
+    this->encode_fixed64(field_id, val.raw, force);
+  }
+  void encode_sfixed32(uint32_t field_id, int32_t value, bool force = false) {
+    this->encode_fixed32(field_id, static_cast<uint32_t>(value), force);
+  }
+  void encode_sfixed64(uint32_t field_id, int64_t value, bool force = false) {
+    this->encode_fixed64(field_id, static_cast<uint64_t>(value), force);
   }
   void encode_int32(uint32_t field_id, int32_t value, bool force = false) {
     if (value < 0) {
@@ -253,16 +267,12 @@ class ProtoWriteBuffer {
     this->encode_uint64(field_id, uvalue, force);
   }
   template<class C> void encode_message(uint32_t field_id, const C &value, bool force = false) {
+    // The length is known up front, so the nested message is encoded in place without moving it afterwards
+    uint32_t nested_length = 0;
+    value.calculate_size(nested_length);
     this->encode_field_raw(field_id, 2);
-    size_t begin = this->buffer_->size();
-
+    this->encode_varint_raw(nested_length);
     value.encode(*this);
-
-    const uint32_t nested_length = this->buffer_->size() - begin;
-    // add size varint
-    std::vector<uint8_t> var;
-    ProtoVarInt(nested_length).encode(var);
-    this->buffer_->insert(this->buffer_->begin() + begin, var.begin(), var.end());
   }
   std::vector<uint8_t> *get_buffer() const { return buffer_; }
 
@@ -270,10 +280,101 @@ class ProtoWriteBuffer {
   std::vector<uint8_t> *buffer_;
 };
 
+/** Encoded sizes of fields, mirroring the encode_* methods of ProtoWriteBuffer.
+ *
+ * Used by the generated calculate_size() methods so that buffers can be sized once and nested messages can be
+ * prefixed with their length before they are encoded. field_id_size is the size of the field header varint.
+ */
+class ProtoSize {
+ public:
+  static uint32_t varint(uint64_t value) {
+    uint32_t size = 1;
+    while (value > 0x7F) {
+      value >>= 7;
+      size++;
+    }
+    return size;
+  }
+  static void add_uint32(uint32_t &total_size, uint32_t field_id_size, uint32_t value, bool force = false) {
+    if (value == 0 && !force)
+      return;
+    total_size += field_id_size + varint(value);
+  }
+  static void add_uint64(uint32_t &total_size, uint32_t field_id_size, uint64_t value, bool force = false) {
+    if (value == 0 && !force)
+      return;
+    total_size += field_id_size + varint(value);
+  }
+  static void add_int32(uint32_t &total_size, uint32_t field_id_size, int32_t value, bool force = false) {
+    if (value < 0) {
+      add_int64(total_size, field_id_size, value, force);
+      return;
+    }
+    add_uint32(total_size, field_id_size, static_cast<uint32_t>(value), force);
+  }
+  static void add_int64(uint32_t &total_size, uint32_t field_id_size, int64_t value, bool force = false) {
+    add_uint64(total_size, field_id_size, static_cast<uint64_t>(value), force);
+  }
+  static void add_sint32(uint32_t &total_size, uint32_t field_id_size, int32_t value, bool force = false) {
+    add_uint32(total_size, field_id_size, value < 0 ? ~(value << 1) : value << 1, force);
+  }
+  static void add_sint64(uint32_t &total_size, uint32_t field_id_size, int64_t value, bool force = false) {
+    add_uint64(total_size, field_id_size, value < 0 ? ~(value << 1) : value << 1, force);
+  }
+  static void add_bool(uint32_t &total_size, uint32_t field_id_size, bool value, bool force = false) {
+    if (!value && !force)
+      return;
+    total_size += field_id_size + 1;
+  }
+  static void add_fixed32(uint32_t &total_size, uint32_t field_id_size, uint32_t value, bool force = false) {
+    if (value == 0 && !force)
+      return;
+    total_size += field_id_size + 4;
+  }
+  static void add_fixed64(uint32_t &total_size, uint32_t field_id_size, uint64_t value, bool force = false) {
+    if (value == 0 && !force)
+      return;
+    total_size += field_id_size + 8;
+  }
+  static void add_float(uint32_t &total_size, uint32_t field_id_size, float value, bool force = false) {
+    if (value == 0.0f && !force)
+      return;
+    total_size += field_id_size + 4;
+  }
+  static void add_double(uint32_t &total_size, uint32_t field_id_size, double value, bool force = false) {
+    if (value == 0.0 && !force)
+      return;
+    total_size += field_id_size + 8;
+  }
+  static void add_sfixed32(uint32_t &total_size, uint32_t field_id_size, int32_t value, bool force = false) {
+    add_fixed32(total_size, field_id_size, static_cast<uint32_t>(value), force);
+  }
+  static void add_sfixed64(uint32_t &total_size, uint32_t field_id_size, int64_t value, bool force = false) {
+    add_fixed64(total_size, field_id_size, static_cast<uint64_t>(value), force);
+  }
+  template<typename T>
+  static void add_enum(uint32_t &total_size, uint32_t field_id_size, T value, bool force = false) {
+    add_uint32(total_size, field_id_size, static_cast<uint32_t>(value), force);
+  }
+  static void add_string(uint32_t &total_size, uint32_t field_id_size, const std::string &value, bool force = false) {
+    if (value.empty() && !force)
+      return;
+    total_size += field_id_size + varint(value.size()) + value.size();
+  }
+  template<class C>
+  static void add_message(uint32_t &total_size, uint32_t field_id_size, const C &value, bool force = false) {
+    uint32_t nested_length = 0;
+    value.calculate_size(nested_length);
+    total_size += field_id_size + varint(nested_length) + nested_length;
+  }
+};
+
 class ProtoMessage {
  public:
   virtual ~ProtoMessage() = default;
   virtual void encode(ProtoWriteBuffer buffer) const = 0;
+  /// Add the encoded size of this message to total_size, without the field header when it is nested.
+  virtual void calculate_size(uint32_t &total_size) const = 0;
   void decode(const uint8_t *buffer, size_t length);
 #ifdef HAS_PROTO_MESSAGE_DUMP
   std::string dump() const;
@@ -297,12 +398,15 @@ class ProtoService {
   virtual void on_fatal_error() = 0;
   virtual void on_unauthenticated_access() = 0;
   virtual void on_no_setup_connection() = 0;
-  virtual ProtoWriteBuffer create_buffer() = 0;
+  /// Create a buffer that can hold a message of reserve_size bytes without reallocating.
+  virtual ProtoWriteBuffer create_buffer(uint32_t reserve_size) = 0;
   virtual bool send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) = 0;
   virtual bool read_message(uint32_t msg_size, uint32_t msg_type, uint8_t *msg_data) = 0;
 
   template<class C> bool send_message_(const C &msg, uint32_t message_type) {
-    auto buffer = this->create_buffer();
+    uint32_t msg_size = 0;
+    msg.calculate_size(msg_size);
+    auto buffer = this->create_buffer(msg_size);
     msg.encode(buffer);
     return this->send_buffer(buffer, message_type);
   }
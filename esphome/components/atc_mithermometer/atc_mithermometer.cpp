@@ -70,7 +70,7 @@ optional<ParseResult> ATCMiThermometer::parse_header_(const esp32_ble_tracker::S
   return result;
 }
 
-bool ATCMiThermometer::parse_message_(const std::vector<uint8_t> &message, ParseResult &result) {
+bool ATCMiThermometer::parse_message_(const esp32_ble_tracker::AdvDataView &message, ParseResult &result) {
   // Byte 0-5 mac in correct order
   // Byte 6-7 Temperature in uint16
   // Byte 8 Humidity in percent
@@ -18,14 +18,17 @@ class BLERSSISensor : public sensor::Sensor, public esp32_ble_tracker::ESPBTDevi
   void set_service_uuid16(uint16_t uuid) {
     this->by_address_ = false;
     this->uuid_ = esp32_ble_tracker::ESPBTUUID::from_uint16(uuid);
+    this->add_service_uuid_filter(this->uuid_);
   }
   void set_service_uuid32(uint32_t uuid) {
     this->by_address_ = false;
     this->uuid_ = esp32_ble_tracker::ESPBTUUID::from_uint32(uuid);
+    this->add_service_uuid_filter(this->uuid_);
   }
   void set_service_uuid128(uint8_t *uuid) {
     this->by_address_ = false;
     this->uuid_ = esp32_ble_tracker::ESPBTUUID::from_raw(uuid);
+    this->add_service_uuid_filter(this->uuid_);
   }
   void on_scan_end() override {
     if (!this->found_)
@@ -1,5 +1,7 @@
 #include "display_buffer.h"
 
+#include <algorithm>
+#include <cstring>
 #include <utility>
 #include "esphome/core/application.h"
 #include "esphome/core/color.h"
@@ -15,6 +17,17 @@ static const char *const TAG = "display";
 const Color COLOR_OFF(0, 0, 0, 0);
 const Color COLOR_ON(255, 255, 255, 255);
 
+/// Cost of sending a region on top of its pixels (setting the address window etc.), in pixels.
+static const int32_t DIRTY_RECT_OVERHEAD = 64;
+
+static DirtyRect unite(const DirtyRect &a, const DirtyRect &b) {
+  return {std::min(a.x1, b.x1), std::min(a.y1, b.y1), std::max(a.x2, b.x2), std::max(a.y2, b.y2)};
+}
+/// Pixels sent in addition when two rectangles are sent as one.
+static int32_t merge_cost(const DirtyRect &a, const DirtyRect &b) {
+  return unite(a, b).area() - a.area() - b.area();
+}
+
 void DisplayBuffer::init_internal_(uint32_t buffer_length) {
   ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
   this->buffer_ = allocator.allocate(buffer_length);
@@ -24,6 +37,120 @@ void DisplayBuffer::init_internal_(uint32_t buffer_length) {
   }
   this->clear();
 }
+void DisplayBuffer::init_frame_copy_(uint32_t buffer_length, uint32_t rows) {
+  if (this->buffer_ == nullptr)
+    return;
+  const auto flags = buffer_length > FRAME_COPY_MAX_INTERNAL ? ExternalRAMAllocator<uint8_t>::REFUSE_INTERNAL
+                                                             : ExternalRAMAllocator<uint8_t>::NONE;
+  ExternalRAMAllocator<uint8_t> allocator(
+      ExternalRAMAllocator<uint8_t>::Flags(flags | ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE));
+  this->frame_copy_ = allocator.allocate(buffer_length);
+  if (this->frame_copy_ == nullptr) {
+    ESP_LOGD(TAG, "No RAM for a %u byte frame copy, unchanged frames are sent again", buffer_length);
+    return;
+  }
+  this->frame_copy_length_ = buffer_length;
+  this->frame_copy_rows_ = (rows != 0 && buffer_length % rows == 0) ? rows : 1;
+}
+void DisplayBuffer::mark_frame_changes_() {
+  const int width = this->get_width_internal();
+  const uint32_t row_bytes = this->frame_copy_length_ / this->frame_copy_rows_;
+  const int lines = this->get_height_internal() / int(this->frame_copy_rows_);
+  for (uint32_t row = 0; row < this->frame_copy_rows_; row++) {
+    const uint8_t *now = this->buffer_ + row * row_bytes;
+    const uint8_t *before = this->frame_copy_ + row * row_bytes;
+    if (memcmp(now, before, row_bytes) == 0)
+      continue;
+    uint32_t first = 0, last = row_bytes - 1;
+    while (now[first] == before[first])
+      first++;
+    while (now[last] == before[last])
+      last--;
+    const int x1 = first * width / row_bytes;
+    const int x2 = ((last + 1) * width + row_bytes - 1) / row_bytes;
+    this->mark_dirty_(x1, row * lines, x2 - x1, lines);
+  }
+}
+void DisplayBuffer::mark_dirty_(int x, int y, int width, int height) {
+  if (width <= 0 || height <= 0)
+    return;
+  DirtyRect rect{x, y, x + width, y + height};
+
+  // merge with the rectangle that grows the least, if that's cheaper than sending another one
+  int best = -1;
+  int32_t best_cost = 0;
+  for (int i = 0; i < this->dirty_count_; i++) {
+    const int32_t cost = merge_cost(this->dirty_rects_[i], rect);
+    if (best == -1 || cost < best_cost) {
+      best = i;
+      best_cost = cost;
+    }
+  }
+  if (best == -1 || (best_cost > DIRTY_RECT_OVERHEAD && this->dirty_count_ < MAX_DIRTY_RECTS)) {
+    best = this->dirty_count_++;
+    this->dirty_rects_[best] = rect;
+  } else {
+    this->dirty_rects_[best] = unite(this->dirty_rects_[best], rect);
+  }
+
+  // the grown rectangle may now be cheaper to send together with another one
+  for (int i = 0; i < this->dirty_count_; i++) {
+    if (i == best || merge_cost(this->dirty_rects_[i], this->dirty_rects_[best]) > DIRTY_RECT_OVERHEAD)
+      continue;
+    const int keep = std::min(i, best), drop = std::max(i, best);
+    this->dirty_rects_[keep] = unite(this->dirty_rects_[keep], this->dirty_rects_[drop]);
+    this->dirty_rects_[drop] = this->dirty_rects_[--this->dirty_count_];
+    best = keep;
+    i = -1;  // check the others again
+  }
+  this->dirty_last_ = best;
+}
+
+static bool pixel_equals(const uint8_t *a, const uint8_t *b, uint8_t bytes_per_pixel) {
+  for (uint8_t i = 0; i < bytes_per_pixel; i++) {
+    if (a[i] != b[i])
+      return false;
+  }
+  return true;
+}
+void DisplayBuffer::fill_buffer_(const uint8_t *pixel, uint8_t bytes_per_pixel) {
+  const int width = this->get_width_internal(), height = this->get_height_internal();
+  const size_t row_bytes = size_t(width) * bytes_per_pixel;
+  // A row that holds only the pixel, the following rows are compared against it in one go
+  const uint8_t *filled_row = nullptr;
+  for (int y = 0; y < height; y++) {
+    uint8_t *row = this->buffer_ + y * row_bytes;
+    if (filled_row != nullptr && memcmp(row, filled_row, row_bytes) == 0)
+      continue;
+    int first = 0, last = width - 1;
+    while (first < width && pixel_equals(row + first * bytes_per_pixel, pixel, bytes_per_pixel))
+      first++;
+    if (first == width) {
+      filled_row = row;
+      continue;
+    }
+    while (pixel_equals(row + last * bytes_per_pixel, pixel, bytes_per_pixel))
+      last--;
+
+    if ((last - first + 1) * 2 > width) {
+      // Most of the row differs, so most of the screen probably does: comparing costs more than filling all of it
+      if (std::all_of(pixel, pixel + bytes_per_pixel, [pixel](uint8_t b) { return b == pixel[0]; })) {
+        memset(this->buffer_, pixel[0], row_bytes * height);
+      } else {
+        for (int x = 0; x < width; x++)
+          memcpy(this->buffer_ + x * bytes_per_pixel, pixel, bytes_per_pixel);
+        for (int i = 1; i < height; i++)
+          memcpy(this->buffer_ + i * row_bytes, this->buffer_, row_bytes);
+      }
+      this->mark_all_dirty_();
+      return;
+    }
+    for (int x = first; x <= last; x++)
+      memcpy(row + x * bytes_per_pixel, pixel, bytes_per_pixel);
+    this->mark_dirty_(first, y, last - first + 1, 1);
+  }
+}
+
 void DisplayBuffer::fill(Color color) { this->filled_rectangle(0, 0, this->get_width(), this->get_height(), color); }
 void DisplayBuffer::clear() { this->fill(COLOR_OFF); }
 int DisplayBuffer::get_width() {
@@ -360,6 +487,14 @@ void DisplayBuffer::show_page(DisplayPage *page) {
 void DisplayBuffer::show_next_page() { this->page_->show_next(); }
 void DisplayBuffer::show_prev_page() { this->page_->show_prev(); }
 void DisplayBuffer::do_update_() {
+  // With a frame copy, the regions marked while clearing and drawing are replaced by the actual difference
+  DirtyRect dirty_rects[MAX_DIRTY_RECTS];
+  const uint8_t dirty_count = this->dirty_count_, dirty_last = this->dirty_last_;
+  if (this->frame_copy_ != nullptr) {
+    memcpy(this->frame_copy_, this->buffer_, this->frame_copy_length_);
+    std::copy(this->dirty_rects_, this->dirty_rects_ + dirty_count, dirty_rects);
+  }
+
   if (this->auto_clear_enabled_) {
     this->clear();
   }
@@ -368,6 +503,14 @@ void DisplayBuffer::do_update_() {
   } else if (this->writer_.has_value()) {
     (*this->writer_)(*this);
   }
+
+  if (this->frame_copy_ != nullptr) {
+    // regions that were already pending before the update stay dirty
+    std::copy(dirty_rects, dirty_rects + dirty_count, this->dirty_rects_);
+    this->dirty_count_ = dirty_count;
+    this->dirty_last_ = dirty_last;
+    this->mark_frame_changes_();
+  }
 }
 void DisplayOnPageChangeTrigger::process(DisplayPage *from, DisplayPage *to) {
   if ((this->from_ == nullptr || this->from_ == from) && (this->to_ == nullptr || this->to_ == to))
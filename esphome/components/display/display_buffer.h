@@ -113,6 +113,24 @@ using display_writer_t = std::function<void(DisplayBuffer &)>;
     ESP_LOGCONFIG(TAG, "%s  Dimensions: %dpx x %dpx", prefix, (obj)->get_width(), (obj)->get_height()); \
   }
 
+/// Region of the display in absolute (unrotated) coordinates, x2 and y2 are exclusive.
+struct DirtyRect {
+  int x1;
+  int y1;
+  int x2;
+  int y2;
+
+  int width() const { return this->x2 - this->x1; }
+  int height() const { return this->y2 - this->y1; }
+  int32_t area() const { return int32_t(this->width()) * this->height(); }
+  bool contains(int x, int y) const { return x >= this->x1 && x < this->x2 && y >= this->y1 && y < this->y2; }
+};
+
+/// Maximum number of separate regions tracked, further changes are merged into them.
+static const uint8_t MAX_DIRTY_RECTS = 4;
+/// Largest frame copy that is put in internal RAM when there is no external RAM.
+static const uint32_t FRAME_COPY_MAX_INTERNAL = 16 * 1024;
+
 class DisplayBuffer {
  public:
   /// Fill the entire screen with the given color.
@@ -379,6 +397,38 @@ class DisplayBuffer {
 
   void init_internal_(uint32_t buffer_length);
 
+  /** Record that a pixel of the buffer changed, so that drivers only need to send the changed regions.
+   *
+   * Drivers call this from draw_absolute_pixel_internal() when the value in the buffer actually changes (redrawing
+   * the same content after auto clear leaves it clean), and send dirty_rects_[0..dirty_count_) on update.
+   */
+  void mark_dirty_(int x, int y) {
+    // most pixels are drawn right next to the previous one
+    if (this->dirty_count_ != 0 && this->dirty_rects_[this->dirty_last_].contains(x, y))
+      return;
+    this->mark_dirty_(x, y, 1, 1);
+  }
+  /// Record that a region of the buffer changed, rectangles are merged when sending them together is cheaper.
+  void mark_dirty_(int x, int y, int width, int height);
+  void mark_all_dirty_() { this->mark_dirty_(0, 0, this->get_width_internal(), this->get_height_internal()); }
+  void clear_dirty_() { this->dirty_count_ = 0; }
+  /** Fill a buffer of bytes_per_pixel bytes per pixel (rows without padding) with one pixel value.
+   *
+   * Only the parts of the rows that changed are written and marked. Once most of a row differs, the whole buffer is
+   * filled and marked instead.
+   */
+  void fill_buffer_(const uint8_t *pixel, uint8_t bytes_per_pixel);
+  /** Keep a copy of the buffer during do_update_(), so that an update only marks what differs from the frame before.
+   *
+   * Without it, auto clear marks every lit pixel and redrawing it marks it again, so an unchanged frame is still
+   * sent. The buffer must consist of rows of equal size, each covering the full width and an equal share of the
+   * lines. The copy costs a second buffer of buffer_length bytes: it is put in external RAM if there is some, and
+   * in internal RAM only up to FRAME_COPY_MAX_INTERNAL bytes. Without the copy, every touched pixel is marked.
+   */
+  void init_frame_copy_(uint32_t buffer_length, uint32_t rows);
+  /// Mark the parts of each row that differ from the copy.
+  void mark_frame_changes_();
+
   void do_update_();
 
   uint8_t *buffer_{nullptr};
@@ -388,6 +438,13 @@ class DisplayBuffer {
   DisplayPage *previous_page_{nullptr};
   std::vector<DisplayOnPageChangeTrigger *> on_page_change_triggers_;
   bool auto_clear_enabled_{true};
+  DirtyRect dirty_rects_[MAX_DIRTY_RECTS];
+  uint8_t dirty_count_{0};
+  /// Rectangle the last pixel was added to.
+  uint8_t dirty_last_{0};
+  uint8_t *frame_copy_{nullptr};
+  uint32_t frame_copy_length_{0};
+  uint32_t frame_copy_rows_{0};
 };
 
 class DisplayPage {
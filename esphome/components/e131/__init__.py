@@ -22,6 +22,7 @@ CHANNELS = {
 
 CONF_UNIVERSE = "universe"
 CONF_E131_ID = "e131_id"
+CONF_DDP = "ddp"
 
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
@@ -30,6 +31,7 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_METHOD, default="MULTICAST"): cv.one_of(
                 *METHODS, upper=True
             ),
+            cv.Optional(CONF_DDP, default=False): cv.boolean,
         }
     ),
     cv.only_with_arduino,
@@ -40,6 +42,7 @@ async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
     cg.add(var.set_method(METHODS[config[CONF_METHOD]]))
+    cg.add(var.set_ddp(config[CONF_DDP]))
 
 
 @register_addressable_effect(
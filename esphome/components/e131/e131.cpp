@@ -3,6 +3,7 @@
 #include "e131.h"
 #include "e131_addressable_light_effect.h"
 #include "esphome/core/log.h"
+#include <algorithm>
 
 #ifdef USE_ESP32
 #include <WiFi.h>
@@ -18,6 +19,9 @@ namespace e131 {
 
 static const char *const TAG = "e131";
 static const int PORT = 5568;
+static const int DDP_PORT = 4048;
+/// Largest packet of either protocol: a full E1.31 universe, or a DDP header with 1440 bytes of data.
+static const size_t MAX_PACKET_SIZE = 1460;
 
 E131Component::E131Component() {}
 
@@ -36,30 +40,53 @@ void E131Component::setup() {
     return;
   }
 
+  if (this->ddp_) {
+    ddp_udp_ = make_unique<WiFiUDP>();
+    if (!ddp_udp_->begin(DDP_PORT)) {
+      ESP_LOGE(TAG, "Cannot bind DDP to %d.", DDP_PORT);
+      mark_failed();
+      return;
+    }
+  }
+
+  buffer_.resize(MAX_PACKET_SIZE);
   join_igmp_groups_();
 }
 
 void E131Component::loop() {
-  std::vector<uint8_t> payload;
   E131Packet packet;
   int universe = 0;
+  uint8_t sequence = 0;
 
   while (uint16_t packet_size = udp_->parsePacket()) {
-    payload.resize(packet_size);
-
-    if (!udp_->read(&payload[0], payload.size())) {
+    // Larger packets are invalid anyway, their data gets dropped with the next parsePacket()
+    auto len = udp_->read(buffer_.data(), std::min<size_t>(packet_size, buffer_.size()));
+    if (len <= 0) {
       continue;
     }
 
-    if (!packet_(payload, universe, packet)) {
-      ESP_LOGV(TAG, "Invalid packet received of size %zu.", payload.size());
+    if (!packet_(buffer_.data(), len, universe, sequence, packet)) {
+      ESP_LOGV(TAG, "Invalid packet received of size %d.", len);
       continue;
     }
 
-    if (!process_(universe, packet)) {
+    if (!process_(universe, sequence, packet)) {
       ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", universe, packet.count);
     }
   }
+
+  if (!ddp_udp_)
+    return;
+  while (uint16_t packet_size = ddp_udp_->parsePacket()) {
+    auto len = ddp_udp_->read(buffer_.data(), std::min<size_t>(packet_size, buffer_.size()));
+    if (len <= 0) {
+      continue;
+    }
+
+    if (!process_ddp_(buffer_.data(), len)) {
+      ESP_LOGV(TAG, "Ignored DDP packet of size %d.", len);
+    }
+  }
 }
 
 void E131Component::add_effect(E131AddressableLightEffect *light_effect) {
@@ -71,6 +98,7 @@ void E131Component::add_effect(E131AddressableLightEffect *light_effect) {
            light_effect->get_first_universe(), light_effect->get_last_universe());
 
   light_effects_.insert(light_effect);
+  update_routes_();
 
   for (auto universe = light_effect->get_first_universe(); universe <= light_effect->get_last_universe(); ++universe) {
     join_(universe);
@@ -86,22 +114,68 @@ void E131Component::remove_effect(E131AddressableLightEffect *light_effect) {
            light_effect->get_first_universe(), light_effect->get_last_universe());
 
   light_effects_.erase(light_effect);
+  update_routes_();
 
   for (auto universe = light_effect->get_first_universe(); universe <= light_effect->get_last_universe(); ++universe) {
     leave_(universe);
   }
 }
 
-bool E131Component::process_(int universe, const E131Packet &packet) {
-  bool handled = false;
+void E131Component::update_routes_() {
+  routes_.clear();
+  for (auto *light_effect : light_effects_) {
+    const int32_t size = light_effect->get_addressable_()->size();
+    const int32_t lights = light_effect->get_lights_per_universe();
+    for (auto universe = light_effect->get_first_universe(); universe <= light_effect->get_last_universe();
+         ++universe) {
+      const int32_t begin = (universe - light_effect->get_first_universe()) * lights;
+      routes_.push_back({universe, light_effect, begin, std::min(begin + lights, size)});
+    }
+  }
+  std::sort(routes_.begin(), routes_.end(), [](const Route &a, const Route &b) { return a.universe < b.universe; });
+}
 
+bool E131Component::check_sequence_(int universe, uint8_t sequence) {
+  auto &stats = universe_stats_[universe];
+  if (stats.received != 0) {
+    // E1.31 section 6.7.2: a packet up to 20 sequence numbers behind the last one is out of order
+    const auto diff = static_cast<int8_t>(sequence - stats.last_sequence);
+    if (diff <= 0 && diff > -20) {
+      stats.out_of_order++;
+      return false;
+    }
+    if (diff > 1) {
+      stats.lost += diff - 1;
+      ESP_LOGV(TAG, "Lost %d packets for %d universe.", diff - 1, universe);
+    }
+  }
+  stats.received++;
+  stats.last_sequence = sequence;
+  return true;
+}
+
+const E131UniverseStats *E131Component::get_universe_stats(int universe) const {
+  auto it = universe_stats_.find(universe);
+  return it == universe_stats_.end() ? nullptr : &it->second;
+}
+
+bool E131Component::process_(int universe, uint8_t sequence, const E131Packet &packet) {
   ESP_LOGV(TAG, "Received E1.31 packet for %d universe, with %d bytes", universe, packet.count);
 
-  for (auto *light_effect : light_effects_) {
-    handled = light_effect->process_(universe, packet) || handled;
+  auto range = std::equal_range(routes_.begin(), routes_.end(), Route{universe, nullptr, 0, 0},
+                                [](const Route &a, const Route &b) { return a.universe < b.universe; });
+  if (range.first == range.second)
+    return false;
+  if (!check_sequence_(universe, sequence))
+    return true;
+
+  // skip the start code
+  for (auto it = range.first; it != range.second; ++it) {
+    it->effect->write_(it->begin, it->end, packet.values + 1, packet.count - 1);
+    it->effect->get_addressable_()->schedule_show();
   }
 
-  return handled;
+  return true;
 }
 
 }  // namespace e131
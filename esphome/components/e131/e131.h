@@ -7,6 +7,7 @@
 #include <memory>
 #include <set>
 #include <map>
+#include <vector>
 
 class UDP;
 
@@ -19,9 +20,20 @@ enum E131ListenMethod { E131_MULTICAST, E131_UNICAST };
 
 const int E131_MAX_PROPERTY_VALUES_COUNT = 513;
 
+/// DMX slots of a received packet, pointing into the receive buffer (values[0] is the start code).
 struct E131Packet {
   uint16_t count;
-  uint8_t values[E131_MAX_PROPERTY_VALUES_COUNT];
+  const uint8_t *values;
+};
+
+/// Receive statistics of one universe.
+struct E131UniverseStats {
+  uint32_t received{0};
+  /// Packets missing according to the sequence numbers.
+  uint32_t lost{0};
+  /// Packets dropped because they were older than the last one.
+  uint32_t out_of_order{0};
+  uint8_t last_sequence{0};
 };
 
 class E131Component : public esphome::Component {
@@ -37,19 +49,42 @@ class E131Component : public esphome::Component {
   void remove_effect(E131AddressableLightEffect *light_effect);
 
   void set_method(E131ListenMethod listen_method) { this->listen_method_ = listen_method; }
+  /// Also receive DDP (Distributed Display Protocol) frames, which are sent to all active effects.
+  void set_ddp(bool ddp) { this->ddp_ = ddp; }
+
+  /// Statistics of a universe, nullptr if nothing was received for it yet.
+  const E131UniverseStats *get_universe_stats(int universe) const;
 
  protected:
-  bool packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet);
-  bool process_(int universe, const E131Packet &packet);
+  /// Pixels of an effect a universe is written to.
+  struct Route {
+    int universe;
+    E131AddressableLightEffect *effect;
+    int32_t begin;
+    int32_t end;
+  };
+
+  bool packet_(const uint8_t *data, size_t len, int &universe, uint8_t &sequence, E131Packet &packet);
+  bool process_(int universe, uint8_t sequence, const E131Packet &packet);
+  bool process_ddp_(const uint8_t *data, size_t len);
+  /// Check the sequence number of a packet, false if it is older than the last one of the universe.
+  bool check_sequence_(int universe, uint8_t sequence);
+  void update_routes_();
   bool join_igmp_groups_();
   void join_(int universe);
   void leave_(int universe);
 
   E131ListenMethod listen_method_{E131_MULTICAST};
+  bool ddp_{false};
   std::unique_ptr<UDP> udp_;
+  std::unique_ptr<UDP> ddp_udp_;
+  /// Received packets are read into this buffer and processed in place.
+  std::vector<uint8_t> buffer_;
   std::set<E131AddressableLightEffect *> light_effects_;
   std::map<int, int> universe_consumers_;
-  std::map<int, E131Packet> universe_packets_;
+  /// Sorted by universe, rebuilt when effects are added or removed.
+  std::vector<Route> routes_;
+  std::map<int, E131UniverseStats> universe_stats_;
 };
 
 }  // namespace e131
@@ -8,7 +8,7 @@ namespace esphome {
 namespace e131 {
 
 static const char *const TAG = "e131_addressable_light_effect";
-static const int MAX_DATA_SIZE = (sizeof(E131Packet::values) - 1);
+static const int MAX_DATA_SIZE = E131_MAX_PROPERTY_VALUES_COUNT - 1;
 
 E131AddressableLightEffect::E131AddressableLightEffect(const std::string &name) : AddressableLightEffect(name) {}
 
@@ -46,48 +46,48 @@ void E131AddressableLightEffect::apply(light::AddressableLight &it, const Color
   // ignore, it is run by `E131Component::update()`
 }
 
-bool E131AddressableLightEffect::process_(int universe, const E131Packet &packet) {
+void E131AddressableLightEffect::write_(int32_t begin, int32_t end, const uint8_t *data, int32_t size) {
   auto *it = get_addressable_();
 
-  // check if this is our universe and data are valid
-  if (universe < first_universe_ || universe > get_last_universe())
-    return false;
+  // limit to the lights of which all channels were received
+  int32_t output_end = std::min(end, begin + size / channels_);
 
-  int output_offset = (universe - first_universe_) * get_lights_per_universe();
-  // limit amount of lights per universe and received
-  int output_end =
-      std::min(it->size(), std::min(output_offset + get_lights_per_universe(), output_offset + packet.count - 1));
-  auto *input_data = packet.values + 1;
-
-  ESP_LOGV(TAG, "Applying data for '%s' on %d universe, for %d-%d.", get_name().c_str(), universe, output_offset,
-           output_end);
+  ESP_LOGV(TAG, "Applying data for '%s', for %d-%d.", get_name().c_str(), begin, output_end);
 
   switch (channels_) {
     case E131_MONO:
-      for (; output_offset < output_end; output_offset++, input_data++) {
-        auto output = (*it)[output_offset];
-        output.set(Color(input_data[0], input_data[0], input_data[0], input_data[0]));
-      }
+      it->generate(begin, output_end, [&data](uint8_t &) {
+        const Color color(data[0], data[0], data[0], data[0]);
+        data++;
+        return color;
+      });
       break;
 
     case E131_RGB:
-      for (; output_offset < output_end; output_offset++, input_data += 3) {
-        auto output = (*it)[output_offset];
-        output.set(
-            Color(input_data[0], input_data[1], input_data[2], (input_data[0] + input_data[1] + input_data[2]) / 3));
-      }
+      it->generate(begin, output_end, [&data](uint8_t &) {
+        const Color color(data[0], data[1], data[2], (data[0] + data[1] + data[2]) / 3);
+        data += 3;
+        return color;
+      });
       break;
 
     case E131_RGBW:
-      for (; output_offset < output_end; output_offset++, input_data += 4) {
-        auto output = (*it)[output_offset];
-        output.set(Color(input_data[0], input_data[1], input_data[2], input_data[3]));
-      }
+      it->copy_from(begin, data, output_end - begin, 4);
       break;
   }
+}
 
-  it->schedule_show();
-  return true;
+void E131AddressableLightEffect::write_ddp_(uint32_t offset, const uint8_t *data, int32_t size, bool push) {
+  auto *it = get_addressable_();
+  const int32_t begin = offset / channels_;
+  // data starting in the middle of a light can't be mapped
+  if (offset % channels_ != 0 || begin >= it->size())
+    return;
+
+  this->write_(begin, it->size(), data, size);
+  // show once the frame is complete: senders mark the last packet, or it reaches the end of the strip
+  if (push || begin + size / channels_ >= it->size())
+    it->schedule_show();
 }
 
 }  // namespace e131
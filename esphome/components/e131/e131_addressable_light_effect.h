@@ -9,7 +9,6 @@ namespace esphome {
 namespace e131 {
 
 class E131Component;
-struct E131Packet;
 
 enum E131LightChannels { E131_MONO = 1, E131_RGB = 3, E131_RGBW = 4 };
 
@@ -32,7 +31,10 @@ class E131AddressableLightEffect : public light::AddressableLightEffect {
   void set_e131(E131Component *e131) { this->e131_ = e131; }
 
  protected:
-  bool process_(int universe, const E131Packet &packet);
+  /// Write DMX data (size bytes of channels_ per light) to the lights [begin, end), without showing them.
+  void write_(int32_t begin, int32_t end, const uint8_t *data, int32_t size);
+  /// Write DDP data, offset is in bytes from the first light.
+  void write_ddp_(uint32_t offset, const uint8_t *data, int32_t size, bool push);
 
   int first_universe_{0};
   int last_universe_{0};
@@ -1,6 +1,7 @@
 #ifdef USE_ARDUINO
 
 #include "e131.h"
+#include "e131_addressable_light_effect.h"
 #include "esphome/core/log.h"
 #include "esphome/core/util.h"
 #include "esphome/components/network/ip_address.h"
@@ -21,6 +22,17 @@ static const uint32_t VECTOR_ROOT = 4;
 static const uint32_t VECTOR_FRAME = 2;
 static const uint8_t VECTOR_DMP = 2;
 
+// DDP (Distributed Display Protocol) header
+static const size_t DDP_HEADER_SIZE = 10;
+static const size_t DDP_TIMECODE_SIZE = 4;
+static const uint8_t DDP_FLAGS_VERSION_MASK = 0xC0;
+static const uint8_t DDP_FLAGS_VERSION_1 = 0x40;
+static const uint8_t DDP_FLAGS_TIMECODE = 0x10;
+static const uint8_t DDP_FLAGS_QUERY = 0x02;
+static const uint8_t DDP_FLAGS_PUSH = 0x01;
+static const uint8_t DDP_ID_DISPLAY = 1;
+static const uint8_t DDP_ID_ALL = 255;
+
 // E1.31 Packet Structure
 union E131RawPacket {
   struct {
@@ -58,6 +70,7 @@ union E131RawPacket {
 // We need to have at least one `1` value
 // Get the offset of `property_values[1]`
 const size_t E131_MIN_PACKET_SIZE = reinterpret_cast<size_t>(&((E131RawPacket *) nullptr)->property_values[1]);
+const size_t E131_HEADER_SIZE = E131_MIN_PACKET_SIZE - 1;
 
 bool E131Component::join_igmp_groups_() {
   if (listen_method_ != E131_MULTICAST)
@@ -112,11 +125,12 @@ void E131Component::leave_(int universe) {
   ESP_LOGD(TAG, "Left %d universe for E1.31.", universe);
 }
 
-bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet) {
-  if (data.size() < E131_MIN_PACKET_SIZE)
+bool E131Component::packet_(const uint8_t *data, size_t len, int &universe, uint8_t &sequence, E131Packet &packet) {
+  if (len < E131_MIN_PACKET_SIZE)
     return false;
 
-  auto *sbuff = reinterpret_cast<const E131RawPacket *>(&data[0]);
+  // The header is checked in the receive buffer, the slots are passed on from there as well
+  auto *sbuff = reinterpret_cast<const E131RawPacket *>(data);
 
   if (memcmp(sbuff->acn_id, ACN_ID, sizeof(sbuff->acn_id)) != 0)
     return false;
@@ -130,14 +144,39 @@ bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E13
     return false;
 
   universe = htons(sbuff->universe);
+  sequence = sbuff->sequence_number;
   packet.count = htons(sbuff->property_value_count);
-  if (packet.count > E131_MAX_PROPERTY_VALUES_COUNT)
+  if (packet.count == 0 || packet.count > E131_MAX_PROPERTY_VALUES_COUNT || E131_HEADER_SIZE + packet.count > len)
     return false;
 
-  memcpy(packet.values, sbuff->property_values, packet.count);
+  packet.values = sbuff->property_values;
   return true;
 }
 
+bool E131Component::process_ddp_(const uint8_t *data, size_t len) {
+  if (len < DDP_HEADER_SIZE)
+    return false;
+  const uint8_t flags = data[0];
+  if ((flags & DDP_FLAGS_VERSION_MASK) != DDP_FLAGS_VERSION_1 || (flags & DDP_FLAGS_QUERY) != 0)
+    return false;
+  if (data[3] != DDP_ID_DISPLAY && data[3] != DDP_ID_ALL)
+    return false;
+
+  const uint32_t offset = (uint32_t(data[4]) << 24) | (uint32_t(data[5]) << 16) | (uint32_t(data[6]) << 8) | data[7];
+  const uint16_t length = (uint16_t(data[8]) << 8) | data[9];
+  const size_t header_size = (flags & DDP_FLAGS_TIMECODE) != 0 ? DDP_HEADER_SIZE + DDP_TIMECODE_SIZE : DDP_HEADER_SIZE;
+  if (header_size + length > len)
+    return false;
+
+  ESP_LOGV(TAG, "Received DDP packet for offset %u, with %u bytes", offset, length);
+
+  const bool push = (flags & DDP_FLAGS_PUSH) != 0;
+  for (auto *light_effect : light_effects_)
+    light_effect->write_ddp_(offset, data + header_size, length, push);
+
+  return !light_effects_.empty();
+}
+
 }  // namespace e131
 }  // namespace esphome
 
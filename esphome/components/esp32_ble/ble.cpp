@@ -151,7 +151,7 @@ bool ESP32BLE::ble_setup_() {
 }
 
 void ESP32BLE::loop() {
-  BLEEvent *ble_event = this->ble_events_.pop();
+  BLEEvent *ble_event = this->ble_events_.front();
   while (ble_event != nullptr) {
     switch (ble_event->type_) {
       case BLEEvent::GATTS:
@@ -164,15 +164,19 @@ void ESP32BLE::loop() {
       default:
         break;
     }
-    delete ble_event;  // NOLINT(cppcoreguidelines-owning-memory)
-    ble_event = this->ble_events_.pop();
+    this->ble_events_.pop();
+    ble_event = this->ble_events_.front();
+  }
+  const uint32_t dropped = this->ble_events_.get_dropped();
+  if (dropped != this->ble_events_dropped_reported_) {
+    ESP_LOGW(TAG, "BLE event queue full, %u events dropped", dropped - this->ble_events_dropped_reported_);
+    this->ble_events_dropped_reported_ = dropped;
   }
 }
 
 void ESP32BLE::gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param) {
-  BLEEvent *new_event = new BLEEvent(event, param);  // NOLINT(cppcoreguidelines-owning-memory)
-  global_ble->ble_events_.push(new_event);
-}  // NOLINT(clang-analyzer-cplusplus.NewDeleteLeaks)
+  global_ble->ble_events_.push(event, param);
+}
 
 void ESP32BLE::real_gap_event_handler_(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param) {
   ESP_LOGV(TAG, "(BLE) gap_event_handler - %d", event);
@@ -184,9 +188,8 @@ void ESP32BLE::real_gap_event_handler_(esp_gap_ble_cb_event_t event, esp_ble_gap
 
 void ESP32BLE::gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if,
                                    esp_ble_gatts_cb_param_t *param) {
-  BLEEvent *new_event = new BLEEvent(event, gatts_if, param);  // NOLINT(cppcoreguidelines-owning-memory)
-  global_ble->ble_events_.push(new_event);
-}  // NOLINT(clang-analyzer-cplusplus.NewDeleteLeaks)
+  global_ble->ble_events_.push(event, gatts_if, param);
+}
 
 void ESP32BLE::real_gatts_event_handler_(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if,
                                          esp_ble_gatts_cb_param_t *param) {
@@ -222,6 +222,9 @@ async def to_code(config):
 
 async def register_ble_device(var, config):
     paren = await cg.get_variable(config[CONF_ESP32_BLE_ID])
+    if CONF_MAC_ADDRESS in config:
+        # Only advertisements from this address are dispatched to the device
+        cg.add(var.add_address_filter(config[CONF_MAC_ADDRESS].as_hex))
     cg.add(paren.register_listener(var))
     return var
 
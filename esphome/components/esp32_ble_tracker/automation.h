@@ -10,7 +10,10 @@ namespace esp32_ble_tracker {
 class ESPBTAdvertiseTrigger : public Trigger<const ESPBTDevice &>, public ESPBTDeviceListener {
  public:
   explicit ESPBTAdvertiseTrigger(ESP32BLETracker *parent) { parent->register_listener(this); }
-  void set_address(uint64_t address) { this->address_ = address; }
+  void set_address(uint64_t address) {
+    this->address_ = address;
+    this->add_address_filter(address);
+  }
 
   bool parse_device(const ESPBTDevice &device) override {
     if (this->address_ && device.address_uint64() != this->address_) {
@@ -27,10 +30,13 @@ class ESPBTAdvertiseTrigger : public Trigger<const ESPBTDevice &>, public ESPBTD
 class BLEServiceDataAdvertiseTrigger : public Trigger<const adv_data_t &>, public ESPBTDeviceListener {
  public:
   explicit BLEServiceDataAdvertiseTrigger(ESP32BLETracker *parent) { parent->register_listener(this); }
-  void set_address(uint64_t address) { this->address_ = address; }
-  void set_service_uuid16(uint16_t uuid) { this->uuid_ = ESPBTUUID::from_uint16(uuid); }
-  void set_service_uuid32(uint32_t uuid) { this->uuid_ = ESPBTUUID::from_uint32(uuid); }
-  void set_service_uuid128(uint8_t *uuid) { this->uuid_ = ESPBTUUID::from_raw(uuid); }
+  void set_address(uint64_t address) {
+    this->address_ = address;
+    this->add_address_filter(address);
+  }
+  void set_service_uuid16(uint16_t uuid) { this->set_service_uuid_(ESPBTUUID::from_uint16(uuid)); }
+  void set_service_uuid32(uint32_t uuid) { this->set_service_uuid_(ESPBTUUID::from_uint32(uuid)); }
+  void set_service_uuid128(uint8_t *uuid) { this->set_service_uuid_(ESPBTUUID::from_raw(uuid)); }
 
   bool parse_device(const ESPBTDevice &device) override {
     if (this->address_ && device.address_uint64() != this->address_) {
@@ -46,6 +52,11 @@ class BLEServiceDataAdvertiseTrigger : public Trigger<const adv_data_t &>, publi
   }
 
  protected:
+  void set_service_uuid_(const ESPBTUUID &uuid) {
+    this->uuid_ = uuid;
+    this->add_service_uuid_filter(uuid);
+  }
+
   uint64_t address_ = 0;
   ESPBTUUID uuid_;
 };
@@ -53,10 +64,13 @@ class BLEServiceDataAdvertiseTrigger : public Trigger<const adv_data_t &>, publi
 class BLEManufacturerDataAdvertiseTrigger : public Trigger<const adv_data_t &>, public ESPBTDeviceListener {
  public:
   explicit BLEManufacturerDataAdvertiseTrigger(ESP32BLETracker *parent) { parent->register_listener(this); }
-  void set_address(uint64_t address) { this->address_ = address; }
-  void set_manufacturer_uuid16(uint16_t uuid) { this->uuid_ = ESPBTUUID::from_uint16(uuid); }
-  void set_manufacturer_uuid32(uint32_t uuid) { this->uuid_ = ESPBTUUID::from_uint32(uuid); }
-  void set_manufacturer_uuid128(uint8_t *uuid) { this->uuid_ = ESPBTUUID::from_raw(uuid); }
+  void set_address(uint64_t address) {
+    this->address_ = address;
+    this->add_address_filter(address);
+  }
+  void set_manufacturer_uuid16(uint16_t uuid) { this->set_manufacturer_uuid_(ESPBTUUID::from_uint16(uuid)); }
+  void set_manufacturer_uuid32(uint32_t uuid) { this->set_manufacturer_uuid_(ESPBTUUID::from_uint32(uuid)); }
+  void set_manufacturer_uuid128(uint8_t *uuid) { this->set_manufacturer_uuid_(ESPBTUUID::from_raw(uuid)); }
 
   bool parse_device(const ESPBTDevice &device) override {
     if (this->address_ && device.address_uint64() != this->address_) {
@@ -72,6 +86,11 @@ class BLEManufacturerDataAdvertiseTrigger : public Trigger<const adv_data_t &>,
   }
 
  protected:
+  void set_manufacturer_uuid_(const ESPBTUUID &uuid) {
+    this->uuid_ = uuid;
+    this->add_manufacturer_id_filter(uuid);
+  }
+
   uint64_t address_ = 0;
   ESPBTUUID uuid_;
 };
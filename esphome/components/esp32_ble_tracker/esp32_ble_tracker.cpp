@@ -51,12 +51,13 @@ void ESP32BLETracker::setup() {
     this->mark_failed();
     return;
   }
+  this->build_listener_index_();
 
   global_esp32_ble_tracker->start_scan_(true);
 }
 
 void ESP32BLETracker::loop() {
-  BLEEvent *ble_event = this->ble_events_.pop();
+  BLEEvent *ble_event = this->ble_events_.front();
   while (ble_event != nullptr) {
     if (ble_event->type_) {
       this->real_gattc_event_handler_(ble_event->event_.gattc.gattc_event, ble_event->event_.gattc.gattc_if,
@@ -64,8 +65,13 @@ void ESP32BLETracker::loop() {
     } else {
       this->real_gap_event_handler_(ble_event->event_.gap.gap_event, &ble_event->event_.gap.gap_param);
     }
-    delete ble_event;  // NOLINT(cppcoreguidelines-owning-memory)
-    ble_event = this->ble_events_.pop();
+    this->ble_events_.pop();
+    ble_event = this->ble_events_.front();
+  }
+  const uint32_t dropped = this->ble_events_.get_dropped();
+  if (dropped != this->ble_events_dropped_reported_) {
+    ESP_LOGW(TAG, "BLE event queue full, %u events dropped", dropped - this->ble_events_dropped_reported_);
+    this->ble_events_dropped_reported_ = dropped;
   }
 
   bool connecting = false;
@@ -86,14 +92,10 @@ void ESP32BLETracker::loop() {
       ESP_LOGW(TAG, "Too many BLE events to process. Some devices may not show up.");
     }
     for (size_t i = 0; i < index; i++) {
-      ESPBTDevice device;
+      ESPBTDevice &device = this->device_;
       device.parse_scan_rst(this->scan_result_buffer_[i]);
 
-      bool found = false;
-      for (auto *listener : this->listeners_) {
-        if (listener->parse_device(device))
-          found = true;
-      }
+      bool found = this->dispatch_device_(device);
 
       for (auto *client : this->clients_) {
         if (client->parse_device(device)) {
@@ -240,15 +242,89 @@ void ESP32BLETracker::start_scan_(bool first) {
   });
 }
 
+/// Hash of the 128 bit form, so 16, 32 and 128 bit notations of the same UUID share a key.
+static uint32_t uuid_key(const ESPBTUUID &uuid) {
+  const esp_bt_uuid_t full = uuid.as_128bit().get_uuid();
+  uint32_t hash = 2166136261UL;
+  for (uint8_t byte : full.uuid.uuid128) {
+    hash ^= byte;
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
+void ESP32BLETracker::build_listener_index_() {
+  for (auto *listener : this->listeners_)
+    this->index_listener_(listener);
+  this->listener_index_built_ = true;
+}
+
+void ESP32BLETracker::index_listener_(ESPBTDeviceListener *listener) {
+  if (!listener->has_filters()) {
+    this->wildcard_listeners_.push_back(listener);
+    return;
+  }
+  for (uint64_t address : listener->address_filters_)
+    this->address_listeners_[address].push_back(listener);
+  for (auto &uuid : listener->service_uuid_filters_)
+    this->service_uuid_listeners_[uuid_key(uuid)].push_back(UUIDListener{uuid, listener});
+  for (auto &id : listener->manufacturer_id_filters_)
+    this->manufacturer_id_listeners_[uuid_key(id)].push_back(UUIDListener{id, listener});
+}
+
+void ESP32BLETracker::dispatch_to_(ESPBTDeviceListener *listener, const ESPBTDevice &device, bool *found) {
+  if (listener->dispatch_round_ == this->dispatch_round_)
+    return;
+  listener->dispatch_round_ = this->dispatch_round_;
+  if (listener->parse_device(device))
+    *found = true;
+}
+
+void ESP32BLETracker::dispatch_uuid_(const UUIDIndex &index, const ESPBTUUID &uuid, const ESPBTDevice &device,
+                                     bool *found) {
+  auto it = index.find(uuid_key(uuid));
+  if (it == index.end())
+    return;
+  for (auto &entry : it->second) {
+    if (entry.uuid == uuid)
+      this->dispatch_to_(entry.listener, device, found);
+  }
+}
+
+bool ESP32BLETracker::dispatch_device_(const ESPBTDevice &device) {
+  // Round 0 is the initial value of every listener
+  if (++this->dispatch_round_ == 0)
+    this->dispatch_round_ = 1;
+  bool found = false;
+  for (auto *listener : this->wildcard_listeners_)
+    this->dispatch_to_(listener, device, &found);
+
+  auto it = this->address_listeners_.find(device.address_uint64());
+  if (it != this->address_listeners_.end()) {
+    for (auto *listener : it->second)
+      this->dispatch_to_(listener, device, &found);
+  }
+  if (!this->service_uuid_listeners_.empty()) {
+    for (auto &uuid : device.get_service_uuids())
+      this->dispatch_uuid_(this->service_uuid_listeners_, uuid, device, &found);
+    for (auto &data : device.get_service_datas())
+      this->dispatch_uuid_(this->service_uuid_listeners_, data.uuid, device, &found);
+  }
+  if (!this->manufacturer_id_listeners_.empty()) {
+    for (auto &data : device.get_manufacturer_datas())
+      this->dispatch_uuid_(this->manufacturer_id_listeners_, data.uuid, device, &found);
+  }
+  return found;
+}
+
 void ESP32BLETracker::register_client(ESPBTClient *client) {
   client->app_id = ++this->app_id_;
   this->clients_.push_back(client);
 }
 
 void ESP32BLETracker::gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param) {
-  BLEEvent *gap_event = new BLEEvent(event, param);  // NOLINT(cppcoreguidelines-owning-memory)
-  global_esp32_ble_tracker->ble_events_.push(gap_event);
-}  // NOLINT(clang-analyzer-cplusplus.NewDeleteLeaks)
+  global_esp32_ble_tracker->ble_events_.push(event, param);
+}
 
 void ESP32BLETracker::real_gap_event_handler_(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param) {
   switch (event) {
@@ -299,9 +375,8 @@ void ESP32BLETracker::gap_scan_result_(const esp_ble_gap_cb_param_t::ble_scan_re
 
 void ESP32BLETracker::gattc_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if,
                                           esp_ble_gattc_cb_param_t *param) {
-  BLEEvent *gattc_event = new BLEEvent(event, gattc_if, param);  // NOLINT(cppcoreguidelines-owning-memory)
-  global_esp32_ble_tracker->ble_events_.push(gattc_event);
-}  // NOLINT(clang-analyzer-cplusplus.NewDeleteLeaks)
+  global_esp32_ble_tracker->ble_events_.push(event, gattc_if, param);
+}
 
 void ESP32BLETracker::real_gattc_event_handler_(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if,
                                                 esp_ble_gattc_cb_param_t *param) {
@@ -493,13 +568,47 @@ optional<ESPBLEiBeacon> ESPBLEiBeacon::from_manufacturer_data(const ServiceData
   return ESPBLEiBeacon(data.data.data());
 }
 
+ESPBTDevice::ESPBTDevice(const ESPBTDevice &other) { *this = other; }
+
+ESPBTDevice &ESPBTDevice::operator=(const ESPBTDevice &other) {
+  if (this == &other)
+    return *this;
+  memcpy(this->address_, other.address_, sizeof(this->address_));
+  this->address_type_ = other.address_type_;
+  this->rssi_ = other.rssi_;
+  this->name_ = other.name_;
+  this->tx_powers_ = other.tx_powers_;
+  this->appearance_ = other.appearance_;
+  this->ad_flag_ = other.ad_flag_;
+  this->service_uuids_ = other.service_uuids_;
+  this->scan_result_ = other.scan_result_;
+  this->manufacturer_datas_ = other.manufacturer_datas_;
+  this->rebase_(this->manufacturer_datas_, other);
+  this->service_datas_ = other.service_datas_;
+  this->rebase_(this->service_datas_, other);
+  return *this;
+}
+
+void ESPBTDevice::rebase_(std::vector<ServiceData> &datas, const ESPBTDevice &other) {
+  for (auto &it : datas)
+    it.data.data_ = this->scan_result_.ble_adv + (it.data.data_ - other.scan_result_.ble_adv);
+}
+
 void ESPBTDevice::parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param) {
   this->scan_result_ = param;
   for (uint8_t i = 0; i < ESP_BD_ADDR_LEN; i++)
     this->address_[i] = param.bda[i];
   this->address_type_ = param.ble_addr_type;
   this->rssi_ = param.rssi;
-  this->parse_adv_(param);
+  this->name_.clear();
+  this->tx_powers_.clear();
+  this->appearance_.reset();
+  this->ad_flag_.reset();
+  this->service_uuids_.clear();
+  this->manufacturer_datas_.clear();
+  this->service_datas_.clear();
+  // Parse our own copy, the data views point into it
+  this->parse_adv_(this->scan_result_);
 
 #ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
   ESP_LOGVV(TAG, "Parse Result:");
@@ -536,7 +645,7 @@ void ESPBTDevice::parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_e
     ESP_LOGVV(TAG, "  Service UUID: %s", uuid.to_string().c_str());
   }
   for (auto &data : this->manufacturer_datas_) {
-    ESP_LOGVV(TAG, "  Manufacturer data: %s", format_hex_pretty(data.data).c_str());
+    ESP_LOGVV(TAG, "  Manufacturer data: %s", format_hex_pretty(data.data.data(), data.data.size()).c_str());
     if (this->get_ibeacon().has_value()) {
       auto ibeacon = this->get_ibeacon().value();
       ESP_LOGVV(TAG, "    iBeacon data:");
@@ -549,7 +658,7 @@ void ESPBTDevice::parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_e
   for (auto &data : this->service_datas_) {
     ESP_LOGVV(TAG, "  Service data:");
     ESP_LOGVV(TAG, "    UUID: %s", data.uuid.to_string().c_str());
-    ESP_LOGVV(TAG, "    Data: %s", format_hex_pretty(data.data).c_str());
+    ESP_LOGVV(TAG, "    Data: %s", format_hex_pretty(data.data.data(), data.data.size()).c_str());
   }
 
   ESP_LOGVV(TAG, "Adv data: %s", format_hex_pretty(param.ble_adv, param.adv_data_len + param.scan_rsp_len).c_str());
@@ -582,14 +691,14 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
         // CSS 1.2 LOCAL NAME
         // "The Local Name data type shall be the same as, or a shortened version of, the local name assigned to the
         // device." CSS 1: Optional in this context; shall not appear more than once in a block.
-        this->name_ = std::string(reinterpret_cast<const char *>(record), record_length);
+        this->name_.assign(reinterpret_cast<const char *>(record), record_length);
         break;
       }
       case ESP_BLE_AD_TYPE_TX_PWR: {
         // CSS 1.5 TX POWER LEVEL
         // "The TX Power Level data type indicates the transmitted power level of the packet containing the data type."
         // CSS 1: Optional in this context (may appear more than once in a block).
-        this->tx_powers_.push_back(*payload);
+        this->tx_powers_.push_back(*record);
         break;
       }
       case ESP_BLE_AD_TYPE_APPEARANCE: {
@@ -648,7 +757,7 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
         }
         ServiceData data{};
         data.uuid = ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record));
-        data.data.assign(record + 2UL, record + record_length);
+        data.data = AdvDataView(record + 2UL, record_length - 2UL);
         this->manufacturer_datas_.push_back(data);
         break;
       }
@@ -666,7 +775,7 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
         }
         ServiceData data{};
         data.uuid = ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record));
-        data.data.assign(record + 2UL, record + record_length);
+        data.data = AdvDataView(record + 2UL, record_length - 2UL);
         this->service_datas_.push_back(data);
         break;
       }
@@ -680,7 +789,7 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
         }
         ServiceData data{};
         data.uuid = ESPBTUUID::from_uint32(*reinterpret_cast<const uint32_t *>(record));
-        data.data.assign(record + 4UL, record + record_length);
+        data.data = AdvDataView(record + 4UL, record_length - 4UL);
         this->service_datas_.push_back(data);
         break;
       }
@@ -694,7 +803,7 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
         }
         ServiceData data{};
         data.uuid = ESPBTUUID::from_raw(record);
-        data.data.assign(record + 16UL, record + record_length);
+        data.data = AdvDataView(record + 16UL, record_length - 16UL);
         this->service_datas_.push_back(data);
         break;
       }
@@ -719,14 +828,12 @@ void ESP32BLETracker::dump_config() {
   ESP_LOGCONFIG(TAG, "  Scan Interval: %.1f ms", this->scan_interval_ * 0.625f);
   ESP_LOGCONFIG(TAG, "  Scan Window: %.1f ms", this->scan_window_ * 0.625f);
   ESP_LOGCONFIG(TAG, "  Scan Type: %s", this->scan_active_ ? "ACTIVE" : "PASSIVE");
+  ESP_LOGCONFIG(TAG, "  Listeners: %u (%u without filters)", this->listeners_.size(),
+                this->wildcard_listeners_.size());
 }
 void ESP32BLETracker::print_bt_device_info(const ESPBTDevice &device) {
-  const uint64_t address = device.address_uint64();
-  for (auto &disc : this->already_discovered_) {
-    if (disc == address)
-      return;
-  }
-  this->already_discovered_.push_back(address);
+  if (!this->already_discovered_.insert(device.address_uint64()).second)
+    return;
 
   ESP_LOGD(TAG, "Found device %s RSSI=%d", device.address_str().c_str(), device.get_rssi());
 
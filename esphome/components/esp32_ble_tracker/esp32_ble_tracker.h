@@ -8,9 +8,13 @@
 
 #include <string>
 #include <array>
+#include <unordered_map>
+#include <unordered_set>
 #include <esp_gap_ble_api.h>
 #include <esp_gattc_api.h>
 #include <esp_bt_defs.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 
 namespace esphome {
 namespace esp32_ble_tracker {
@@ -46,9 +50,37 @@ class ESPBTUUID {
 
 using adv_data_t = std::vector<uint8_t>;
 
+/** A read-only view of advertisement data that points into the raw scan result of an ESPBTDevice.
+ *
+ * Parsing an advertisement doesn't copy any data, the view is only valid as long as the device it came from.
+ * It converts to (and from) adv_data_t, so code that needs to keep or modify the data can still copy it.
+ */
+class AdvDataView {
+ public:
+  AdvDataView() = default;
+  AdvDataView(const uint8_t *data, size_t size) : data_(data), size_(size) {}
+  AdvDataView(const adv_data_t &data) : data_(data.data()), size_(data.size()) {}  // NOLINT
+
+  const uint8_t *data() const { return this->data_; }
+  size_t size() const { return this->size_; }
+  bool empty() const { return this->size_ == 0; }
+  const uint8_t &operator[](size_t index) const { return this->data_[index]; }
+  const uint8_t *begin() const { return this->data_; }
+  const uint8_t *end() const { return this->data_ + this->size_; }
+
+  adv_data_t to_vector() const { return adv_data_t(this->begin(), this->end()); }
+  operator adv_data_t() const { return this->to_vector(); }  // NOLINT
+
+ protected:
+  friend class ESPBTDevice;
+
+  const uint8_t *data_{nullptr};
+  size_t size_{0};
+};
+
 struct ServiceData {
   ESPBTUUID uuid;
-  adv_data_t data;
+  AdvDataView data;
 };
 
 class ESPBLEiBeacon {
@@ -75,6 +107,12 @@ class ESPBLEiBeacon {
 
 class ESPBTDevice {
  public:
+  ESPBTDevice() = default;
+  /// Copies rebase the data views onto the copied scan result.
+  ESPBTDevice(const ESPBTDevice &other);
+  ESPBTDevice &operator=(const ESPBTDevice &other);
+
+  /// Parse a scan result into this device, the containers of a previous result are reused.
   void parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param);
 
   std::string address_str() const;
@@ -110,6 +148,7 @@ class ESPBTDevice {
 
  protected:
   void parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param);
+  void rebase_(std::vector<ServiceData> &datas, const ESPBTDevice &other);
 
   esp_bd_addr_t address_{
       0,
@@ -134,8 +173,30 @@ class ESPBTDeviceListener {
   virtual bool parse_device(const ESPBTDevice &device) = 0;
   void set_parent(ESP32BLETracker *parent) { parent_ = parent; }
 
+  /** Filters narrow down which advertisements the tracker passes to parse_device().
+   *
+   * An advertisement is passed if it matches any filter, a listener without filters gets every advertisement.
+   * They only save calls: parse_device() still has to check the device itself. Filters must be added before the
+   * tracker is set up.
+   */
+  void add_address_filter(uint64_t address) { this->address_filters_.push_back(address); }
+  /// Match advertisements listing this service UUID or carrying service data for it.
+  void add_service_uuid_filter(const ESPBTUUID &uuid) { this->service_uuid_filters_.push_back(uuid); }
+  void add_manufacturer_id_filter(const ESPBTUUID &id) { this->manufacturer_id_filters_.push_back(id); }
+  bool has_filters() const {
+    return !this->address_filters_.empty() || !this->service_uuid_filters_.empty() ||
+           !this->manufacturer_id_filters_.empty();
+  }
+
  protected:
+  friend class ESP32BLETracker;
+
   ESP32BLETracker *parent_{nullptr};
+  std::vector<uint64_t> address_filters_;
+  std::vector<ESPBTUUID> service_uuid_filters_;
+  std::vector<ESPBTUUID> manufacturer_id_filters_;
+  /// Last advertisement this listener was called for, so it's called once even if several filters match.
+  uint32_t dispatch_round_{0};
 };
 
 enum class ClientState {
@@ -182,6 +243,8 @@ class ESP32BLETracker : public Component {
   void register_listener(ESPBTDeviceListener *listener) {
     listener->set_parent(this);
     this->listeners_.push_back(listener);
+    if (this->listener_index_built_)
+      this->index_listener_(listener);
   }
 
   void register_client(ESPBTClient *client);
@@ -189,6 +252,20 @@ class ESP32BLETracker : public Component {
   void print_bt_device_info(const ESPBTDevice &device);
 
  protected:
+  struct UUIDListener {
+    ESPBTUUID uuid;
+    ESPBTDeviceListener *listener;
+  };
+  using UUIDIndex = std::unordered_map<uint32_t, std::vector<UUIDListener>>;
+
+  /// Sort the listeners into the dispatch indexes by their filters.
+  void build_listener_index_();
+  void index_listener_(ESPBTDeviceListener *listener);
+  /// Call the listeners interested in a device, returns whether one of them handled it.
+  bool dispatch_device_(const ESPBTDevice &device);
+  void dispatch_uuid_(const UUIDIndex &index, const ESPBTUUID &uuid, const ESPBTDevice &device, bool *found);
+  void dispatch_to_(ESPBTDeviceListener *listener, const ESPBTDevice &device, bool *found);
+
   /// The FreeRTOS task managing the bluetooth interface.
   static bool ble_setup();
   /// Start a single scan by setting up the parameters and doing some esp-idf calls.
@@ -210,9 +287,17 @@ class ESP32BLETracker : public Component {
   static void gattc_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if, esp_ble_gattc_cb_param_t *param);
   void real_gattc_event_handler_(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if, esp_ble_gattc_cb_param_t *param);
 
-  /// Vector of addresses that have already been printed in print_bt_device_info
-  std::vector<uint64_t> already_discovered_;
+  /// Addresses that have already been printed in print_bt_device_info
+  std::unordered_set<uint64_t> already_discovered_;
   std::vector<ESPBTDeviceListener *> listeners_;
+  /// Listeners without filters, called for every advertisement.
+  std::vector<ESPBTDeviceListener *> wildcard_listeners_;
+  std::unordered_map<uint64_t, std::vector<ESPBTDeviceListener *>> address_listeners_;
+  /// Keyed by a hash of the 128 bit form of the UUID, entries are compared in full.
+  UUIDIndex service_uuid_listeners_;
+  UUIDIndex manufacturer_id_listeners_;
+  uint32_t dispatch_round_{0};
+  bool listener_index_built_{false};
   /// Client parameters.
   std::vector<ESPBTClient *> clients_;
   /// A structure holding the ESP BLE scan parameters.
@@ -226,10 +311,14 @@ class ESP32BLETracker : public Component {
   SemaphoreHandle_t scan_end_lock_;
   size_t scan_result_index_{0};
   esp_ble_gap_cb_param_t::ble_scan_result_evt_param scan_result_buffer_[16];
+  /// Reused for every scan result, so parsing doesn't allocate once its containers have grown.
+  ESPBTDevice device_;
   esp_bt_status_t scan_start_failed_{ESP_BT_STATUS_SUCCESS};
   esp_bt_status_t scan_set_param_failed_{ESP_BT_STATUS_SUCCESS};
 
-  Queue<BLEEvent> ble_events_;
+  /// All 64 events are allocated statically: about 7.5 KB on the ESP32, more with BLE 5 extended advertising.
+  LockFreeQueue<BLEEvent, 64> ble_events_;
+  uint32_t ble_events_dropped_reported_{0};
 };
 
 // NOLINTNEXTLINE
@@ -19,13 +19,14 @@ from esphome.helpers import copy_file_if_changed
 
 from .const import (
     CONF_RESTORE_FROM_FLASH,
+    CONF_PREFERENCES_FLASH_SECTORS,
     CONF_EARLY_PIN_INIT,
     KEY_BOARD,
     KEY_ESP8266,
     KEY_PIN_INITIAL_STATES,
     esp8266_ns,
 )
-from .boards import ESP8266_FLASH_SIZES, ESP8266_LD_SCRIPTS
+from .boards import ESP8266_FLASH_SIZES, ESP8266_LD_SCRIPTS, ESP8266_LD_SCRIPTS_WITH_FS
 
 from .gpio import PinInitialState, add_pin_initial_states_array
 
@@ -142,6 +143,25 @@ ARDUINO_FRAMEWORK_SCHEMA = cv.All(
 )
 
 
+def _validate_preferences_flash_sectors(config):
+    if config[CONF_PREFERENCES_FLASH_SECTORS] == 1:
+        return config
+    # The extra sectors are reserved by building with a layout that has a filesystem area, which needs a known
+    # flash size and the ld script names of Arduino 2.5.0+
+    if config[CONF_BOARD] not in ESP8266_FLASH_SIZES:
+        raise cv.Invalid(
+            f"The flash layout of board '{config[CONF_BOARD]}' is not known, more than one "
+            "preferences flash sector can't be reserved",
+            path=[CONF_PREFERENCES_FLASH_SECTORS],
+        )
+    if CORE.data[KEY_CORE][KEY_FRAMEWORK_VERSION] <= cv.Version(2, 4, 2):
+        raise cv.Invalid(
+            "More than one preferences flash sector requires Arduino framework 2.5.0 or newer",
+            path=[CONF_PREFERENCES_FLASH_SECTORS],
+        )
+    return config
+
+
 BUILD_FLASH_MODES = ["qio", "qout", "dio", "dout"]
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
@@ -149,6 +169,14 @@ CONFIG_SCHEMA = cv.All(
             cv.Required(CONF_BOARD): cv.string_strict,
             cv.Optional(CONF_FRAMEWORK, default={}): ARDUINO_FRAMEWORK_SCHEMA,
             cv.Optional(CONF_RESTORE_FROM_FLASH, default=False): cv.boolean,
+            # Number of 4KB sectors the flash preferences (restore_from_flash) are spread over, each one takes a
+            # share of the erases. Sectors beyond the first are the last ones of the filesystem area, so more than
+            # one switches to a layout with a 64KB filesystem area (1MB on 4MB boards, 14MB on 16MB boards) that
+            # must not be used by a filesystem. On 512KB to 2MB boards this takes 64KB from the firmware and OTA
+            # space. Don't override board_build.ldscript together with this option.
+            cv.Optional(CONF_PREFERENCES_FLASH_SECTORS, default=1): cv.int_range(
+                min=1, max=16
+            ),
             cv.Optional(CONF_EARLY_PIN_INIT, default=True): cv.boolean,
             cv.Optional(CONF_BOARD_FLASH_MODE, default="dout"): cv.one_of(
                 *BUILD_FLASH_MODES, lower=True
@@ -156,12 +184,13 @@ CONFIG_SCHEMA = cv.All(
         }
     ),
     set_core_data,
+    _validate_preferences_flash_sectors,
 )
 
 
 @coroutine_with_priority(1000)
 async def to_code(config):
-    cg.add(esp8266_ns.setup_preferences())
+    cg.add(esp8266_ns.setup_preferences(config[CONF_PREFERENCES_FLASH_SECTORS]))
 
     cg.add_platformio_option("lib_ldf_mode", "off")
 
@@ -230,6 +259,8 @@ async def to_code(config):
             ld_script = ld_scripts[0]
         else:
             ld_script = ld_scripts[1]
+            if config[CONF_PREFERENCES_FLASH_SECTORS] > 1:
+                ld_script = ESP8266_LD_SCRIPTS_WITH_FS[flash_size]
 
         if ld_script is not None:
             cg.add_platformio_option("board_build.ldscript", ld_script)
@@ -56,6 +56,16 @@ ESP8266_LD_SCRIPTS = {
     FLASH_SIZE_16_MB: ("eagle.flash.16m.ld", "eagle.flash.16m14m.ld"),
 }
 
+# Layouts with a filesystem area of at least 64KB (Arduino 2.5.0+ names). The preferences log takes the sectors it
+# needs beyond the preferences sector from the end of the filesystem area.
+ESP8266_LD_SCRIPTS_WITH_FS = {
+    FLASH_SIZE_512_KB: "eagle.flash.512k64.ld",
+    FLASH_SIZE_1_MB: "eagle.flash.1m64.ld",
+    FLASH_SIZE_2_MB: "eagle.flash.2m64.ld",
+    FLASH_SIZE_4_MB: "eagle.flash.4m1m.ld",
+    FLASH_SIZE_16_MB: "eagle.flash.16m14m.ld",
+}
+
 ESP8266_BASE_PINS = {
     "A0": 17,
     "SS": 15,
@@ -6,6 +6,7 @@ extern "C" {
 }
 
 #include "preferences.h"
+#include "preferences_log.h"
 #include <cstring>
 #include "esphome/core/preferences.h"
 #include "esphome/core/helpers.h"
@@ -19,7 +20,7 @@ static const char *const TAG = "esp8266.preferences";
 
 static bool s_prevent_write = false;         // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 static uint32_t *s_flash_storage = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
-static bool s_flash_dirty = false;           // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static PreferenceLog *s_flash_log = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
 static const uint32_t ESP_RTC_USER_MEM_START = 0x60001200;
 #define ESP_RTC_USER_MEM ((uint32_t *) ESP_RTC_USER_MEM_START)
@@ -53,7 +54,8 @@ static inline bool esp_rtc_user_mem_write(uint32_t index, uint32_t value) {
   return true;
 }
 
-extern "C" uint32_t _SPIFFS_end;  // NOLINT
+extern "C" uint32_t _SPIFFS_start;  // NOLINT
+extern "C" uint32_t _SPIFFS_end;    // NOLINT
 
 static uint32_t get_esp8266_flash_sector() {
   union {
@@ -64,6 +66,44 @@ static uint32_t get_esp8266_flash_sector() {
   return (data.uint - 0x40200000) / SPI_FLASH_SEC_SIZE;
 }
 static uint32_t get_esp8266_flash_address() { return get_esp8266_flash_sector() * SPI_FLASH_SEC_SIZE; }
+/// Number of sectors that can be taken from the end of the filesystem in addition to the preferences sector.
+static uint32_t get_esp8266_filesystem_sectors() {
+  union {
+    uint32_t *ptr;
+    uint32_t uint;
+  } start{}, end{};
+  start.ptr = &_SPIFFS_start;
+  end.ptr = &_SPIFFS_end;
+  return (end.uint - start.uint) / SPI_FLASH_SEC_SIZE;
+}
+
+/// Flash sectors used by the preferences log, the last one is the sector preferences were always stored in.
+class ESP8266PreferenceFlash : public PreferenceFlash {
+ public:
+  explicit ESP8266PreferenceFlash(uint32_t first_sector) : first_sector_(first_sector) {}
+
+  bool read(uint32_t sector, uint32_t word, uint32_t *data, size_t words) override {
+    InterruptLock lock;
+    return spi_flash_read(this->address_(sector, word), data, words * 4) == SPI_FLASH_RESULT_OK;
+  }
+  bool write(uint32_t sector, uint32_t word, const uint32_t *data, size_t words) override {
+    InterruptLock lock;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    return spi_flash_write(this->address_(sector, word), const_cast<uint32_t *>(data), words * 4) ==
+           SPI_FLASH_RESULT_OK;
+  }
+  bool erase(uint32_t sector) override {
+    InterruptLock lock;
+    return spi_flash_erase_sector(this->first_sector_ + sector) == SPI_FLASH_RESULT_OK;
+  }
+
+ protected:
+  uint32_t address_(uint32_t sector, uint32_t word) const {
+    return (this->first_sector_ + sector) * SPI_FLASH_SEC_SIZE + word * 4;
+  }
+
+  uint32_t first_sector_;
+};
 
 template<class It> uint32_t calculate_crc(It first, It last, uint32_t type) {
   uint32_t crc = type;
@@ -78,11 +118,10 @@ static bool save_to_flash(size_t offset, const uint32_t *data, size_t len) {
     uint32_t j = offset + i;
     if (j >= ESP8266_FLASH_STORAGE_SIZE)
       return false;
-    uint32_t v = data[i];
-    uint32_t *ptr = &s_flash_storage[j];
-    if (*ptr != v)
-      s_flash_dirty = true;
-    *ptr = v;
+    if (s_flash_storage[j] != data[i]) {
+      s_flash_storage[j] = data[i];
+      s_flash_log->mark_dirty(j, 1);
+    }
   }
   return true;
 }
@@ -165,11 +204,22 @@ class ESP8266Preferences : public ESPPreferences {
   uint32_t current_offset = 0;
   uint32_t current_flash_offset = 0;  // in words
 
-  void setup() {
+  void setup(uint32_t flash_sectors) {
     s_flash_storage = new uint32_t[ESP8266_FLASH_STORAGE_SIZE];  // NOLINT
     ESP_LOGVV(TAG, "Loading preferences from flash...");
 
-    {
+    const uint32_t available = get_esp8266_filesystem_sectors() + 1;
+    if (flash_sectors > available) {
+      ESP_LOGW(TAG, "Only %u flash sectors are available for preferences", available);
+      flash_sectors = available;
+    }
+    auto *flash = new ESP8266PreferenceFlash(get_esp8266_flash_sector() + 1 - flash_sectors);  // NOLINT
+    memset(s_flash_storage, 0, ESP8266_FLASH_STORAGE_SIZE * 4);
+    s_flash_log = new PreferenceLog(flash, flash_sectors, s_flash_storage, ESP8266_FLASH_STORAGE_SIZE);  // NOLINT
+    if (!s_flash_log->load()) {
+      // Preferences written before the log format was used are a raw image at the start of the sector, each value
+      // has its own CRC so reading them is safe even if the sector holds something else. The first sync converts it.
+      ESP_LOGD(TAG, "No preferences log found, reading legacy image");
       InterruptLock lock;
       spi_flash_read(get_esp8266_flash_address(), s_flash_storage, ESP8266_FLASH_STORAGE_SIZE * 4);
     }
@@ -228,37 +278,24 @@ class ESP8266Preferences : public ESPPreferences {
   }
 
   bool sync() override {
-    if (!s_flash_dirty)
+    if (!s_flash_log->is_dirty())
       return true;
     if (s_prevent_write)
       return false;
 
     ESP_LOGD(TAG, "Saving preferences to flash...");
-    SpiFlashOpResult erase_res, write_res = SPI_FLASH_RESULT_OK;
-    {
-      InterruptLock lock;
-      erase_res = spi_flash_erase_sector(get_esp8266_flash_sector());
-      if (erase_res == SPI_FLASH_RESULT_OK) {
-        write_res = spi_flash_write(get_esp8266_flash_address(), s_flash_storage, ESP8266_FLASH_STORAGE_SIZE * 4);
-      }
-    }
-    if (erase_res != SPI_FLASH_RESULT_OK) {
-      ESP_LOGV(TAG, "Erase ESP8266 flash failed!");
+    if (!s_flash_log->sync()) {
+      ESP_LOGV(TAG, "Writing ESP8266 flash failed!");
       return false;
     }
-    if (write_res != SPI_FLASH_RESULT_OK) {
-      ESP_LOGV(TAG, "Write ESP8266 flash failed!");
-      return false;
-    }
-
-    s_flash_dirty = false;
+    ESP_LOGVV(TAG, "Flash sectors erased since boot: %u", s_flash_log->get_erase_count());
     return true;
   }
 };
 
-void setup_preferences() {
+void setup_preferences(uint32_t flash_sectors) {
   auto *pref = new ESP8266Preferences();  // NOLINT(cppcoreguidelines-owning-memory)
-  pref->setup();
+  pref->setup(flash_sectors);
   global_preferences = pref;
 }
 void preferences_prevent_write(bool prevent) { s_prevent_write = prevent; }
@@ -2,10 +2,13 @@
 
 #ifdef USE_ESP8266
 
+#include <cstdint>
+
 namespace esphome {
 namespace esp8266 {
 
-void setup_preferences();
+/// Set up the global preferences, flash preferences are kept in a log spread over flash_sectors sectors.
+void setup_preferences(uint32_t flash_sectors);
 void preferences_prevent_write(bool prevent);
 
 }  // namespace esp8266
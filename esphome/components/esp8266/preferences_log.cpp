@@ -0,0 +1,221 @@
+#ifdef USE_ESP8266
+
+#include "preferences_log.h"
+#include "esphome/core/crc.h"
+#include <cstring>
+
+namespace esphome {
+namespace esp8266 {
+
+static const uint32_t SECTOR_MAGIC = 0x4C485045;  // "EPHL"
+static const uint32_t BLANK_WORD = 0xFFFFFFFF;
+static const uint32_t RECORD_MARKER = 0xA5000000;
+static const uint32_t RECORD_MARKER_MASK = 0xFF000000;
+/// Words of the sector header (magic and sequence number).
+static const uint32_t SECTOR_HEADER_WORDS = 2;
+/// Words a record takes in addition to its data (header and CRC).
+static const uint32_t RECORD_OVERHEAD_WORDS = 2;
+/// Changed words closer than this are written as one record, which is cheaper than a second header and CRC.
+static const uint32_t MERGE_GAP_WORDS = RECORD_OVERHEAD_WORDS;
+
+/// Words read at once while checking a record.
+static const uint32_t VERIFY_CHUNK_WORDS = 16;
+
+static uint32_t record_header(uint32_t offset, uint32_t length) { return RECORD_MARKER | (offset << 12) | length; }
+
+/// CRC-32 over words in memory order.
+static uint32_t crc32_update(uint32_t crc, const uint32_t *data, size_t words) {
+  return esphome::crc32_update(crc, reinterpret_cast<const uint8_t *>(data), words * 4);
+}
+
+PreferenceLog::PreferenceLog(PreferenceFlash *flash, uint32_t sector_count, uint32_t *image, size_t image_words)
+    : flash_(flash),
+      sector_count_(sector_count),
+      image_(image),
+      image_words_(image_words),
+      dirty_(new uint32_t[(image_words + 31) / 32]),  // NOLINT(cppcoreguidelines-owning-memory)
+      sector_(sector_count - 1) {
+  this->clear_dirty_();
+}
+
+bool PreferenceLog::load() {
+  // Try sectors from newest to oldest, an interrupted compaction leaves a sector without a valid snapshot
+  uint32_t tried = 0;
+  for (uint32_t attempt = 0; attempt < this->sector_count_; attempt++) {
+    bool found = false;
+    uint32_t best = 0, best_sequence = 0;
+    for (uint32_t sector = 0; sector < this->sector_count_; sector++) {
+      uint32_t header[SECTOR_HEADER_WORDS];
+      if ((tried & (1UL << sector)) != 0 || !this->flash_->read(sector, 0, header, SECTOR_HEADER_WORDS))
+        continue;
+      if (header[0] != SECTOR_MAGIC)
+        continue;
+      if (!found || header[1] > best_sequence) {
+        found = true;
+        best = sector;
+        best_sequence = header[1];
+      }
+    }
+    if (!found)
+      return false;
+    tried |= 1UL << best;
+    if (this->load_sector_(best)) {
+      this->sequence_ = best_sequence;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool PreferenceLog::load_sector_(uint32_t sector) {
+  uint32_t offset, length;
+  uint32_t pos = SECTOR_HEADER_WORDS;
+  if (!this->verify_record_(sector, pos, &offset, &length) || offset != 0 || length != this->image_words_)
+    return false;
+
+  this->needs_compaction_ = false;
+  while (pos < SECTOR_WORDS) {
+    // Records are verified before they are applied, so a failed read leaves the image as of the previous record
+    if (!this->flash_->read(sector, pos + 1, &this->image_[offset], length)) {
+      this->needs_compaction_ = true;
+      break;
+    }
+    pos += length + RECORD_OVERHEAD_WORDS;
+
+    uint32_t header;
+    if (pos >= SECTOR_WORDS || !this->flash_->read(sector, pos, &header, 1) || header == BLANK_WORD)
+      break;
+    if (!this->verify_record_(sector, pos, &offset, &length)) {
+      // Interrupted write, the words after it can't be appended to without an erase
+      this->needs_compaction_ = true;
+      break;
+    }
+  }
+
+  this->sector_ = sector;
+  this->write_pos_ = pos;
+  this->clear_dirty_();
+  return true;
+}
+
+bool PreferenceLog::verify_record_(uint32_t sector, uint32_t pos, uint32_t *offset, uint32_t *length) {
+  uint32_t header;
+  if (pos + RECORD_OVERHEAD_WORDS > SECTOR_WORDS || !this->flash_->read(sector, pos, &header, 1))
+    return false;
+  if ((header & RECORD_MARKER_MASK) != RECORD_MARKER)
+    return false;
+  *offset = (header >> 12) & 0xFFF;
+  *length = header & 0xFFF;
+  if (*length == 0 || *offset + *length > this->image_words_ || pos + *length + RECORD_OVERHEAD_WORDS > SECTOR_WORDS)
+    return false;
+
+  uint32_t crc = crc32_update(0xFFFFFFFF, &header, 1);
+  uint32_t chunk[VERIFY_CHUNK_WORDS];
+  for (uint32_t i = 0; i < *length; i += VERIFY_CHUNK_WORDS) {
+    const uint32_t words = *length - i < VERIFY_CHUNK_WORDS ? *length - i : VERIFY_CHUNK_WORDS;
+    if (!this->flash_->read(sector, pos + 1 + i, chunk, words))
+      return false;
+    crc = crc32_update(crc, chunk, words);
+  }
+  uint32_t stored_crc;
+  if (!this->flash_->read(sector, pos + 1 + *length, &stored_crc, 1))
+    return false;
+  return ~crc == stored_crc;
+}
+
+bool PreferenceLog::write_record_(uint32_t offset, uint32_t length) {
+  // Header first: a record cut short by a reset is then detected by its CRC instead of looking like free space
+  const uint32_t header = record_header(offset, length);
+  const uint32_t crc = ~crc32_update(crc32_update(0xFFFFFFFF, &header, 1), &this->image_[offset], length);
+  const uint32_t pos = this->write_pos_;
+  if (!this->flash_->write(this->sector_, pos, &header, 1) ||
+      !this->flash_->write(this->sector_, pos + 1, &this->image_[offset], length) ||
+      !this->flash_->write(this->sector_, pos + 1 + length, &crc, 1)) {
+    this->needs_compaction_ = true;
+    return false;
+  }
+  this->write_pos_ += length + RECORD_OVERHEAD_WORDS;
+  for (uint32_t i = offset; i < offset + length; i++)
+    this->dirty_[i / 32] &= ~(1UL << (i % 32));
+  return true;
+}
+
+void PreferenceLog::mark_dirty(uint32_t offset, uint32_t length) {
+  for (uint32_t i = offset; i < offset + length && i < this->image_words_; i++)
+    this->dirty_[i / 32] |= 1UL << (i % 32);
+}
+
+void PreferenceLog::clear_dirty_() { memset(this->dirty_.get(), 0, (this->image_words_ + 31) / 32 * 4); }
+
+bool PreferenceLog::next_run_(uint32_t from, uint32_t *offset, uint32_t *length) const {
+  uint32_t i = from;
+  while (i < this->image_words_ && !this->is_word_dirty_(i))
+    i++;
+  if (i == this->image_words_)
+    return false;
+  *offset = i;
+  uint32_t end = i + 1;  // one past the last dirty word
+  for (uint32_t j = end; j < this->image_words_ && j <= end + MERGE_GAP_WORDS; j++) {
+    if (this->is_word_dirty_(j))
+      end = j + 1;
+  }
+  *length = end - i;
+  return true;
+}
+
+bool PreferenceLog::sync() {
+  if (this->needs_compaction_)
+    return this->compact_();
+
+  uint32_t offset, length;
+  uint32_t needed = 0;
+  for (uint32_t pos = 0; this->next_run_(pos, &offset, &length); pos = offset + length)
+    needed += length + RECORD_OVERHEAD_WORDS;
+  if (needed == 0)
+    return true;
+  if (this->write_pos_ + needed > SECTOR_WORDS)
+    return this->compact_();
+
+  for (uint32_t pos = 0; this->next_run_(pos, &offset, &length); pos = offset + length) {
+    if (!this->write_record_(offset, length))
+      return false;
+  }
+  return true;
+}
+
+bool PreferenceLog::compact_() {
+  const uint32_t sector = (this->sector_ + 1) % this->sector_count_;
+  // Whatever happens from here, the next attempt should use a fresh sector
+  this->sector_ = sector;
+  this->needs_compaction_ = true;
+
+  this->erase_count_++;
+  if (!this->flash_->erase(sector))
+    return false;
+  this->write_pos_ = SECTOR_HEADER_WORDS;
+  if (!this->write_record_(0, this->image_words_))
+    return false;
+  // Only now the sector becomes valid
+  const uint32_t header[SECTOR_HEADER_WORDS] = {SECTOR_MAGIC, this->sequence_ + 1};
+  if (!this->flash_->write(sector, 0, header, SECTOR_HEADER_WORDS))
+    return false;
+
+  this->sequence_++;
+  this->needs_compaction_ = false;
+  return true;
+}
+
+bool PreferenceLog::is_dirty() const {
+  if (this->needs_compaction_)
+    return true;
+  for (uint32_t i = 0; i < (this->image_words_ + 31) / 32; i++) {
+    if (this->dirty_[i] != 0)
+      return true;
+  }
+  return false;
+}
+
+}  // namespace esp8266
+}  // namespace esphome
+
+#endif  // USE_ESP8266
@@ -0,0 +1,78 @@
+#pragma once
+
+#ifdef USE_ESP8266
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace esphome {
+namespace esp8266 {
+
+/// Flash access used by PreferenceLog. Sectors are numbered from 0 and words are addressed within a sector.
+class PreferenceFlash {
+ public:
+  virtual bool read(uint32_t sector, uint32_t word, uint32_t *data, size_t words) = 0;
+  virtual bool write(uint32_t sector, uint32_t word, const uint32_t *data, size_t words) = 0;
+  virtual bool erase(uint32_t sector) = 0;
+};
+
+/** Log-structured storage of the flash preferences image.
+ *
+ * Instead of erasing and rewriting a sector on every sync, only the words marked dirty since the last sync are
+ * appended as records to the active sector. When it is full, the whole image is compacted into the next sector
+ * (round-robin), so erases are spread over all sectors and happen only once every few hundred syncs.
+ *
+ * Sector layout: magic, sequence number, a snapshot record of the whole image, then delta records. Records are
+ * a header word (marker, offset and length in words), the data and a CRC-32 over header and data. Loading picks
+ * the valid sector with the highest sequence number and replays its records until the first blank or corrupt
+ * one, so an interrupted write only loses that write. The sector header is written last, a sector whose
+ * compaction was interrupted is ignored in favour of the previous one (with more than one sector).
+ */
+class PreferenceLog {
+ public:
+  static const uint32_t SECTOR_WORDS = 1024;
+
+  PreferenceLog(PreferenceFlash *flash, uint32_t sector_count, uint32_t *image, size_t image_words);
+
+  /// Restore the image from flash, returns false (leaving the image untouched) if no valid sector was found.
+  bool load();
+  /// Mark words of the image as changed, they are written on the next sync().
+  void mark_dirty(uint32_t offset, uint32_t length);
+  /// Persist all dirty words of the image.
+  bool sync();
+  /// Whether sync() has anything to write.
+  bool is_dirty() const;
+
+  uint32_t get_erase_count() const { return this->erase_count_; }
+
+ protected:
+  bool load_sector_(uint32_t sector);
+  /// Check the header and CRC of the record at pos, without touching the image.
+  bool verify_record_(uint32_t sector, uint32_t pos, uint32_t *offset, uint32_t *length);
+  bool write_record_(uint32_t offset, uint32_t length);
+  /// Find the next range of dirty words at or after from, small gaps of clean words are included.
+  bool next_run_(uint32_t from, uint32_t *offset, uint32_t *length) const;
+  bool is_word_dirty_(uint32_t index) const { return (this->dirty_[index / 32] >> (index % 32)) & 1; }
+  void clear_dirty_();
+  bool compact_();
+
+  PreferenceFlash *flash_;
+  uint32_t sector_count_;
+  uint32_t *image_;
+  size_t image_words_;
+  /// One bit per word of the image.
+  std::unique_ptr<uint32_t[]> dirty_;
+  uint32_t sector_{0};
+  uint32_t sequence_{0};
+  /// Next free word in the active sector.
+  uint32_t write_pos_{0};
+  /// Set when the active sector can't be appended to (no valid sector, corrupt tail or failed write).
+  bool needs_compaction_{true};
+  uint32_t erase_count_{0};
+};
+
+}  // namespace esp8266
+}  // namespace esphome
+
+#endif  // USE_ESP8266
@@ -9,6 +9,7 @@ from esphome.const import (
 )
 
 CODEOWNERS = ["@OttoWinter"]
+CONF_ASYNC = "async"
 fastled_base_ns = cg.esphome_ns.namespace("fastled_base")
 FastLEDLightOutput = fastled_base_ns.class_(
     "FastLEDLightOutput", light.AddressableLight
@@ -29,6 +30,7 @@ BASE_SCHEMA = light.ADDRESSABLE_LIGHT_SCHEMA.extend(
         cv.Required(CONF_NUM_LEDS): cv.positive_not_null_int,
         cv.Optional(CONF_RGB_ORDER): cv.one_of(*RGB_ORDERS, upper=True),
         cv.Optional(CONF_MAX_REFRESH_RATE): cv.positive_time_period_microseconds,
+        cv.Optional(CONF_ASYNC): cv.All(cv.only_on_esp32, cv.boolean),
     }
 ).extend(cv.COMPONENT_SCHEMA)
 
@@ -39,6 +41,8 @@ async def new_fastled_light(config):
 
     if CONF_MAX_REFRESH_RATE in config:
         cg.add(var.set_max_refresh_rate(config[CONF_MAX_REFRESH_RATE]))
+    if CONF_ASYNC in config:
+        cg.add(var.set_async(config[CONF_ASYNC]))
 
     await light.register_light(var, config)
     # https://github.com/FastLED/FastLED/blob/master/library.json
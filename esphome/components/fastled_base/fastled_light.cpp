@@ -2,12 +2,28 @@
 
 #include "fastled_light.h"
 #include "esphome/core/log.h"
+#include <cstring>
 
 namespace esphome {
 namespace fastled_base {
 
 static const char *const TAG = "fastled";
 
+#ifdef USE_ESP32
+// FastLED's drivers keep global state, only one strip may be sent at a time
+static SemaphoreHandle_t show_lock = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/** Stack of the show task in bytes.
+ *
+ * The task only runs CLEDController::showLeds(): FastLED's own scaling and dithering (a PixelController of about
+ * 100 bytes) and the RMT or I2S driver. Power supply requests and ESPHome's color correction happen in the main loop
+ * before the frame is copied to the front buffer, never on this task. The largest user is the first frame, which
+ * installs the ESP-IDF RMT driver and may log from there, and formatting a log line takes about 1.5 KB. The
+ * remaining headroom is logged with the frame statistics.
+ */
+static const uint32_t SHOW_TASK_STACK_SIZE = 3072;
+#endif
+
 void FastLEDLightOutput::setup() {
   ESP_LOGCONFIG(TAG, "Setting up FastLED light...");
   this->controller_->init();
@@ -16,26 +32,97 @@ void FastLEDLightOutput::setup() {
   if (!this->max_refresh_rate_.has_value()) {
     this->set_max_refresh_rate(this->controller_->getMaxRefreshRate());
   }
+
+#ifdef USE_ESP32
+  if (this->async_) {
+    if (show_lock == nullptr)
+      show_lock = xSemaphoreCreateMutex();
+    this->front_ = new CRGB[this->num_leds_];  // NOLINT
+    memcpy(this->front_, this->leds_, this->num_leds_ * sizeof(CRGB));
+    this->controller_->setLeds(this->front_, this->num_leds_);
+    xTaskCreate(FastLEDLightOutput::show_task, "fastled", SHOW_TASK_STACK_SIZE, this, 2, &this->show_task_handle_);
+  }
+#endif
 }
 void FastLEDLightOutput::dump_config() {
   ESP_LOGCONFIG(TAG, "FastLED light:");
   ESP_LOGCONFIG(TAG, "  Num LEDs: %u", this->num_leds_);
   ESP_LOGCONFIG(TAG, "  Max refresh rate: %u", *this->max_refresh_rate_);
+#ifdef USE_ESP32
+  ESP_LOGCONFIG(TAG, "  Async: %s", YESNO(this->async_));
+#endif
 }
 void FastLEDLightOutput::write_state(light::LightState *state) {
+  if (this->frame_pending_) {
+    // the previous frame never made it to the strip
+    this->count_frame_dropped_();
+    ESP_LOGVV(TAG, "Dropped frame (%u so far)", this->get_frames_dropped());
+  }
+  this->frame_pending_ = true;
+  this->show_pending_();
+  if (this->frame_pending_)
+    this->enable_loop();
+}
+void FastLEDLightOutput::loop() {
+  // retry here so that a frame held back by the refresh rate won't get lost
+  if (this->frame_pending_)
+    this->show_pending_();
+  if (!this->frame_pending_)
+    this->disable_loop();
+}
+void FastLEDLightOutput::show_pending_() {
   // protect from refreshing too often
   uint32_t now = micros();
-  if (*this->max_refresh_rate_ != 0 && (now - this->last_refresh_) < *this->max_refresh_rate_) {
-    // try again next loop iteration, so that this change won't get lost
-    this->schedule_show();
+  if (*this->max_refresh_rate_ != 0 && (now - this->last_refresh_) < *this->max_refresh_rate_)
     return;
+#ifdef USE_ESP32
+  if (this->async_) {
+    // the previous frame is still being sent from the front buffer
+    if (this->sending_)
+      return;
+    memcpy(this->front_, this->leds_, this->num_leds_ * sizeof(CRGB));
+    this->sending_ = true;
+    xTaskNotifyGive(this->show_task_handle_);
   }
+#endif
   this->last_refresh_ = now;
+  this->frame_pending_ = false;
+  this->count_frame_shown_();
   this->mark_shown_();
 
+#ifdef USE_ESP32
+  if (this->async_)
+    return;
+  if (show_lock != nullptr)
+    xSemaphoreTake(show_lock, portMAX_DELAY);
+#endif
   ESP_LOGVV(TAG, "Writing RGB values to bus...");
   this->controller_->showLeds();
+#ifdef USE_ESP32
+  if (show_lock != nullptr)
+    xSemaphoreGive(show_lock);
+#endif
+}
+
+#ifdef USE_ESP32
+void FastLEDLightOutput::log_frame_stats_() {
+  AddressableLight::log_frame_stats_();
+  if (this->show_task_handle_ != nullptr) {
+    ESP_LOGV(TAG, "Show task stack: %u of %u bytes never used", uxTaskGetStackHighWaterMark(this->show_task_handle_),
+             SHOW_TASK_STACK_SIZE);
+  }
+}
+void FastLEDLightOutput::show_task(void *param) {
+  auto *output = reinterpret_cast<FastLEDLightOutput *>(param);
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    xSemaphoreTake(show_lock, portMAX_DELAY);
+    output->controller_->showLeds();
+    xSemaphoreGive(show_lock);
+    output->sending_ = false;
+  }
 }
+#endif
 
 }  // namespace fastled_base
 }  // namespace esphome
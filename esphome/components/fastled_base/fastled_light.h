@@ -15,6 +15,13 @@
 
 #include "FastLED.h"
 
+#ifdef USE_ESP32
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#endif
+
 namespace esphome {
 namespace fastled_base {
 
@@ -28,6 +35,14 @@ class FastLEDLightOutput : public light::AddressableLight {
   /// Set a maximum refresh rate in µs as some lights do not like being updated too often.
   void set_max_refresh_rate(uint32_t interval_us) { this->max_refresh_rate_ = interval_us; }
 
+#ifdef USE_ESP32
+  /** Send frames from a background task, so the main loop doesn't block while the strip is updated.
+   *
+   * The LEDs are copied to a second (front) buffer that the task sends, while effects render into the first one.
+   */
+  void set_async(bool async) { this->async_ = async; }
+#endif
+
   /// Add some LEDS, can only be called once.
   CLEDController &add_leds(CLEDController *controller, int num_leds) {
     this->controller_ = controller;
@@ -216,6 +231,7 @@ class FastLEDLightOutput : public light::AddressableLight {
   void setup() override;
   void dump_config() override;
   void write_state(light::LightState *state) override;
+  void loop() override;
   float get_setup_priority() const override { return setup_priority::HARDWARE; }
 
   void clear_effect_data() override {
@@ -228,6 +244,25 @@ class FastLEDLightOutput : public light::AddressableLight {
     return {&this->leds_[index].r,      &this->leds_[index].g, &this->leds_[index].b, nullptr,
             &this->effect_data_[index], &this->correction_};
   }
+  bool get_span_internal(int32_t index, int32_t max_size, light::ESPPixelSpan *span) const override {
+    // CRGB is laid out as r, g, b
+    span->pixels = &this->leds_[index].r;
+    span->stride = sizeof(CRGB);
+    span->red = 0;
+    span->green = 1;
+    span->blue = 2;
+    span->white = -1;
+    span->effect_data = &this->effect_data_[index];
+    span->size = std::min(max_size, this->num_leds_ - index);
+    return true;
+  }
+
+  /// Send the pending frame if the refresh rate and the strip allow it, otherwise leave it for the next loop.
+  void show_pending_();
+#ifdef USE_ESP32
+  static void show_task(void *param);
+  void log_frame_stats_() override;
+#endif
 
   CLEDController *controller_{nullptr};
   CRGB *leds_{nullptr};
@@ -235,6 +270,14 @@ class FastLEDLightOutput : public light::AddressableLight {
   int num_leds_{0};
   uint32_t last_refresh_{0};
   optional<uint32_t> max_refresh_rate_{};
+  bool frame_pending_{false};
+#ifdef USE_ESP32
+  bool async_{false};
+  /// Copy of the LEDs being sent by the show task.
+  CRGB *front_{nullptr};
+  TaskHandle_t show_task_handle_{nullptr};
+  std::atomic<bool> sending_{false};
+#endif
 };
 
 }  // namespace fastled_base
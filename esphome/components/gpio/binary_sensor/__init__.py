@@ -2,9 +2,12 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome import pins
 from esphome.components import binary_sensor
-from esphome.const import CONF_PIN
+from esphome.const import CONF_ESPHOME, CONF_IDLE_SLEEP, CONF_NUMBER, CONF_PIN
+from esphome.core import CORE
 from .. import gpio_ns
 
+CONF_USE_INTERRUPT = "use_interrupt"
+
 GPIOBinarySensor = gpio_ns.class_(
     "GPIOBinarySensor", binary_sensor.BinarySensor, cg.Component
 )
@@ -14,6 +17,8 @@ CONFIG_SCHEMA = (
     .extend(
         {
             cv.Required(CONF_PIN): pins.gpio_input_pin_schema,
+            # Defaults to the esphome idle_sleep option, polling keeps the loop busy anyway without it
+            cv.Optional(CONF_USE_INTERRUPT): cv.boolean,
         }
     )
     .extend(cv.COMPONENT_SCHEMA)
@@ -26,3 +31,14 @@ async def to_code(config):
 
     pin = await cg.gpio_pin_expression(config[CONF_PIN])
     cg.add(var.set_pin(pin))
+
+    use_interrupt = config.get(
+        CONF_USE_INTERRUPT, CORE.config[CONF_ESPHOME][CONF_IDLE_SLEEP]
+    )
+    if CORE.is_esp8266 and config[CONF_PIN].get(CONF_NUMBER) == 16:
+        # GPIO16 can't trigger interrupts on the ESP8266
+        use_interrupt = False
+    if CORE.is_host:
+        # Host pins have no interrupts
+        use_interrupt = False
+    cg.add(var.set_use_interrupt(use_interrupt))
@@ -9,14 +9,28 @@ static const char *const TAG = "gpio.binary_sensor";
 void GPIOBinarySensor::setup() {
   this->pin_->setup();
   this->publish_initial_state(this->pin_->digital_read());
+  if (this->use_interrupt_ && !this->pin_->is_internal())
+    this->use_interrupt_ = false;
+  if (this->use_interrupt_) {
+    auto *pin = static_cast<InternalGPIOPin *>(this->pin_);
+    pin->attach_interrupt(&GPIOBinarySensor::gpio_intr, this, gpio::INTERRUPT_ANY_EDGE);
+  }
 }
 
+void IRAM_ATTR GPIOBinarySensor::gpio_intr(GPIOBinarySensor *arg) { arg->enable_loop_soon_any_context(); }
+
 void GPIOBinarySensor::dump_config() {
   LOG_BINARY_SENSOR("", "GPIO Binary Sensor", this);
   LOG_PIN("  Pin: ", this->pin_);
+  ESP_LOGCONFIG(TAG, "  Mode: %s", this->use_interrupt_ ? "interrupt" : "polling");
 }
 
-void GPIOBinarySensor::loop() { this->publish_state(this->pin_->digital_read()); }
+void GPIOBinarySensor::loop() {
+  this->publish_state(this->pin_->digital_read());
+  // An edge that comes in after the read re-enables the loop on the next iteration
+  if (this->use_interrupt_)
+    this->disable_loop();
+}
 
 float GPIOBinarySensor::get_setup_priority() const { return setup_priority::HARDWARE; }
 
@@ -10,6 +10,8 @@ namespace gpio {
 class GPIOBinarySensor : public binary_sensor::BinarySensor, public Component {
  public:
   void set_pin(GPIOPin *pin) { pin_ = pin; }
+  /// Only read the pin after an edge interrupt instead of on every loop iteration (internal pins only).
+  void set_use_interrupt(bool use_interrupt) { use_interrupt_ = use_interrupt; }
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Setup pin
@@ -21,7 +23,10 @@ class GPIOBinarySensor : public binary_sensor::BinarySensor, public Component {
   void loop() override;
 
  protected:
+  static void gpio_intr(GPIOBinarySensor *arg);
+
   GPIOPin *pin_;
+  bool use_interrupt_{false};
 };
 
 }  // namespace gpio
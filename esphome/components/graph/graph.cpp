@@ -16,8 +16,9 @@ static const char *const TAG = "graph";
 static const char *const TAGL = "graphlegend";
 
 void HistoryData::init(int length) {
-  this->length_ = length;
-  this->samples_.resize(length, NAN);
+  this->samples_.init(length);
+  for (int i = 0; i < length; i++)
+    this->samples_.push_back(NAN);
   this->last_sample_ = millis();
 }
 
@@ -29,21 +30,22 @@ void HistoryData::take_sample(float data) {
   // Step data based on time
   this->period_ += dt;
   while (this->period_ >= this->update_time_) {
-    this->samples_[this->count_] = data;
+    this->samples_.push_back(data);
     this->period_ -= this->update_time_;
-    this->count_ = (this->count_ + 1) % this->length_;
     ESP_LOGV(TAG, "Updating trace with value: %f", data);
   }
   if (!std::isnan(data)) {
     // Recalc recent max/min
     this->recent_min_ = data;
     this->recent_max_ = data;
-    for (int i = 0; i < this->length_; i++) {
-      if (!std::isnan(this->samples_[i])) {
-        if (this->recent_max_ < this->samples_[i])
-          this->recent_max_ = this->samples_[i];
-        if (this->recent_min_ > this->samples_[i])
-          this->recent_min_ = this->samples_[i];
+    // The buffer is always full, so the raw storage holds exactly the samples
+    const float *samples = this->samples_.data();
+    for (size_t i = 0; i < this->samples_.size(); i++) {
+      if (!std::isnan(samples[i])) {
+        if (this->recent_max_ < samples[i])
+          this->recent_max_ = samples[i];
+        if (this->recent_min_ > samples[i])
+          this->recent_min_ = samples[i];
       }
     }
   }
@@ -2,6 +2,7 @@
 #include "esphome/components/sensor/sensor.h"
 #include "esphome/core/color.h"
 #include "esphome/core/component.h"
+#include "esphome/core/ring_buffer.h"
 #include <cstdint>
 #include <utility>
 
@@ -88,8 +89,9 @@ class HistoryData {
   ~HistoryData();
   void set_update_time_ms(uint32_t update_time_ms) { update_time_ = update_time_ms; }
   void take_sample(float data);
-  int get_length() const { return length_; }
-  float get_value(int idx) const { return samples_[(count_ + length_ - 1 - idx) % length_]; }
+  int get_length() const { return samples_.size(); }
+  /// The idx-th most recent sample, 0 being the newest.
+  float get_value(int idx) const { return samples_[samples_.size() - 1 - idx]; }
   float get_recent_max() const { return recent_max_; }
   float get_recent_min() const { return recent_min_; }
 
@@ -97,11 +99,9 @@ class HistoryData {
   uint32_t last_sample_;
   uint32_t period_{0};       /// in ms
   uint32_t update_time_{0};  /// in ms
-  int length_;
-  int count_{0};
   float recent_min_{NAN};
   float recent_max_{NAN};
-  std::vector<float> samples_;
+  RingBuffer<float> samples_;
 };
 
 class GraphTrace {
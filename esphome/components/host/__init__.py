@@ -0,0 +1,53 @@
+from esphome.const import (
+    KEY_CORE,
+    KEY_FRAMEWORK_VERSION,
+    KEY_TARGET_FRAMEWORK,
+    KEY_TARGET_PLATFORM,
+)
+from esphome.core import CORE, coroutine_with_priority
+import esphome.config_validation as cv
+import esphome.codegen as cg
+
+from .const import KEY_HOST, host_ns
+
+# force import gpio to register pin schema
+from .gpio import host_pin_to_code  # noqa
+
+
+CODEOWNERS = ["@esphome/core"]
+AUTO_LOAD = ["preferences", "socket"]
+
+CONF_PREFERENCES_FILE = "preferences_file"
+
+
+def set_core_data(config):
+    CORE.data[KEY_HOST] = {}
+    CORE.data[KEY_CORE][KEY_TARGET_PLATFORM] = "host"
+    CORE.data[KEY_CORE][KEY_TARGET_FRAMEWORK] = "host"
+    CORE.data[KEY_CORE][KEY_FRAMEWORK_VERSION] = cv.Version(1, 0, 0)
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Optional(CONF_PREFERENCES_FILE): cv.string_strict,
+        }
+    ),
+    set_core_data,
+)
+
+
+@coroutine_with_priority(1000)
+async def to_code(config):
+    preferences_file = config.get(CONF_PREFERENCES_FILE)
+    if preferences_file is None:
+        preferences_file = CORE.relative_build_path(f"{CORE.name}.prefs")
+    cg.add(host_ns.setup_preferences(preferences_file))
+
+    cg.add_platformio_option("platform", "platformio/native")
+    cg.add_platformio_option("lib_ldf_mode", "off")
+    cg.add_build_flag("-DUSE_HOST")
+    cg.add_build_flag("-std=gnu++17")
+    cg.add_define("ESPHOME_BOARD", "host")
+    cg.add_define("ESPHOME_VARIANT", "host")
@@ -0,0 +1,5 @@
+import esphome.codegen as cg
+
+KEY_HOST = "host"
+
+host_ns = cg.esphome_ns.namespace("host")
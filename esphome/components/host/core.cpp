@@ -0,0 +1,72 @@
+#ifdef USE_HOST
+
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "preferences.h"
+
+#include <cstdlib>
+#include <ctime>
+#include <sched.h>
+#include <unistd.h>
+
+void setup();
+void loop();
+
+namespace esphome {
+
+static char **saved_argv = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+static uint64_t monotonic_us() {
+  struct timespec ts {};
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return uint64_t(ts.tv_sec) * 1000000ULL + uint64_t(ts.tv_nsec) / 1000ULL;
+}
+
+void HOT yield() { sched_yield(); }
+uint32_t IRAM_ATTR HOT millis() { return uint32_t(monotonic_us() / 1000ULL); }
+uint32_t IRAM_ATTR HOT micros() { return uint32_t(monotonic_us()); }
+void HOT delay(uint32_t ms) {
+  struct timespec ts {};
+  ts.tv_sec = ms / 1000;
+  ts.tv_nsec = long(ms % 1000) * 1000000L;
+  while (nanosleep(&ts, &ts) != 0) {
+    // interrupted by a signal, sleep for the remaining time
+  }
+}
+void HOT delayMicroseconds(uint32_t us) {
+  struct timespec ts {};
+  ts.tv_sec = us / 1000000;
+  ts.tv_nsec = long(us % 1000000) * 1000L;
+  while (nanosleep(&ts, &ts) != 0) {
+  }
+}
+void arch_restart() {
+  host::preferences_flush();
+  // Replace the process with a fresh copy of itself, the closest thing to a reboot
+  if (saved_argv != nullptr)
+    execv("/proc/self/exe", saved_argv);
+  exit(0);
+}
+void arch_init() {}
+void HOT arch_feed_wdt() {}
+
+uint8_t progmem_read_byte(const uint8_t *addr) { return *addr; }
+uint32_t arch_get_cpu_cycle_count() {
+  struct timespec ts {};
+  clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+  return uint32_t(uint64_t(ts.tv_sec) * 1000000000ULL + uint64_t(ts.tv_nsec));
+}
+// Cycle counts are nanoseconds, see arch_get_cpu_cycle_count()
+uint32_t arch_get_cpu_freq_hz() { return 1000000000U; }
+
+}  // namespace esphome
+
+int main(int argc, char **argv) {
+  esphome::saved_argv = argv;
+  setup();
+  while (true) {
+    loop();
+  }
+}
+
+#endif  // USE_HOST
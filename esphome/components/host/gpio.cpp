@@ -0,0 +1,72 @@
+#ifdef USE_HOST
+
+#include "gpio.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace host {
+
+static const char *const TAG = "host";
+
+static bool pin_levels[MAX_PINS];  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+static void set_level(uint8_t pin, bool level) {
+  if (pin < MAX_PINS)
+    pin_levels[pin] = level;
+}
+static bool get_level(uint8_t pin) { return pin < MAX_PINS && pin_levels[pin]; }
+static void apply_mode(uint8_t pin, gpio::Flags flags) {
+  if (flags & gpio::FLAG_PULLUP) {
+    set_level(pin, true);
+  } else if (flags & gpio::FLAG_PULLDOWN) {
+    set_level(pin, false);
+  }
+}
+
+struct ISRPinArg {
+  uint8_t pin;
+  bool inverted;
+};
+
+ISRInternalGPIOPin HostGPIOPin::to_isr() const {
+  auto *arg = new ISRPinArg{};  // NOLINT(cppcoreguidelines-owning-memory)
+  arg->pin = pin_;
+  arg->inverted = inverted_;
+  return ISRInternalGPIOPin((void *) arg);
+}
+
+void HostGPIOPin::pin_mode(gpio::Flags flags) { apply_mode(pin_, flags); }
+
+std::string HostGPIOPin::dump_summary() const {
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), "GPIO%u", pin_);
+  return buffer;
+}
+
+bool HostGPIOPin::digital_read() { return get_level(pin_) != inverted_; }
+void HostGPIOPin::digital_write(bool value) {
+  ESP_LOGVV(TAG, "Writing %s to GPIO%u", ONOFF(value), pin_);
+  set_level(pin_, value != inverted_);
+}
+
+}  // namespace host
+
+using namespace host;
+
+bool IRAM_ATTR ISRInternalGPIOPin::digital_read() {
+  auto *arg = reinterpret_cast<ISRPinArg *>(arg_);
+  return get_level(arg->pin) != arg->inverted;
+}
+void IRAM_ATTR ISRInternalGPIOPin::digital_write(bool value) {
+  auto *arg = reinterpret_cast<ISRPinArg *>(arg_);
+  set_level(arg->pin, value != arg->inverted);
+}
+void IRAM_ATTR ISRInternalGPIOPin::clear_interrupt() {}
+void IRAM_ATTR ISRInternalGPIOPin::pin_mode(gpio::Flags flags) {
+  auto *arg = reinterpret_cast<ISRPinArg *>(arg_);
+  apply_mode(arg->pin, flags);
+}
+
+}  // namespace esphome
+
+#endif  // USE_HOST
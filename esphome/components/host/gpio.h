@@ -0,0 +1,46 @@
+#pragma once
+
+#ifdef USE_HOST
+
+#include "esphome/core/hal.h"
+
+namespace esphome {
+namespace host {
+
+/// Number of simulated pins, keep in sync with MAX_PINS in gpio.py.
+static const uint8_t MAX_PINS = 64;
+
+/** A simulated GPIO pin.
+ *
+ * There is no hardware behind host pins: every pin is a level in memory that digital_write() sets and
+ * digital_read() returns, so pins can be wired up in a config and driven by other code in the same process.
+ * A pin configured with a pull-up reads high until it is written. Interrupts are accepted but never fire.
+ */
+class HostGPIOPin : public InternalGPIOPin {
+ public:
+  void set_pin(uint8_t pin) { pin_ = pin; }
+  void set_inverted(bool inverted) { inverted_ = inverted; }
+  void set_flags(gpio::Flags flags) { flags_ = flags; }
+
+  void setup() override { pin_mode(flags_); }
+  void pin_mode(gpio::Flags flags) override;
+  bool digital_read() override;
+  void digital_write(bool value) override;
+  std::string dump_summary() const override;
+  void detach_interrupt() const override {}
+  ISRInternalGPIOPin to_isr() const override;
+  uint8_t get_pin() const override { return pin_; }
+  bool is_inverted() const override { return inverted_; }
+
+ protected:
+  void attach_interrupt(void (*func)(void *), void *arg, gpio::InterruptType type) const override {}
+
+  uint8_t pin_;
+  bool inverted_;
+  gpio::Flags flags_;
+};
+
+}  // namespace host
+}  // namespace esphome
+
+#endif  // USE_HOST
@@ -0,0 +1,137 @@
+#ifdef USE_HOST
+
+#include "preferences.h"
+#include "esphome/core/preferences.h"
+#include "esphome/core/log.h"
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace esphome {
+namespace host {
+
+static const char *const TAG = "host.preferences";
+
+/** Preferences stored in a single file on the host.
+ *
+ * All values are kept in memory, keyed by their type hash. Saves only update the in-memory copy, sync() rewrites
+ * the whole file (through a temporary file and a rename, so an interrupted write never loses the old contents).
+ * The file is a sequence of records, each a 32-bit key, a 32-bit length and the data, all in host byte order.
+ */
+class HostPreferences : public ESPPreferences {
+ public:
+  explicit HostPreferences(std::string filename) : filename_(std::move(filename)) {}
+
+  void load_file() {
+    FILE *file = fopen(this->filename_.c_str(), "rb");
+    if (file == nullptr) {
+      ESP_LOGD(TAG, "No preferences file at '%s'", this->filename_.c_str());
+      return;
+    }
+    uint32_t header[2];
+    while (fread(header, sizeof(header), 1, file) == 1) {
+      std::vector<uint8_t> data(header[1]);
+      if (!data.empty() && fread(data.data(), data.size(), 1, file) != 1) {
+        ESP_LOGW(TAG, "Preferences file '%s' is truncated", this->filename_.c_str());
+        break;
+      }
+      this->values_[header[0]] = std::move(data);
+    }
+    fclose(file);
+    ESP_LOGD(TAG, "Loaded %zu preferences from '%s'", this->values_.size(), this->filename_.c_str());
+  }
+
+  bool save(uint32_t key, const uint8_t *data, size_t len) {
+    auto &value = this->values_[key];
+    if (value.size() == len && std::equal(data, data + len, value.begin()))
+      return true;
+    value.assign(data, data + len);
+    this->dirty_ = true;
+    return true;
+  }
+  bool load(uint32_t key, uint8_t *data, size_t len) {
+    auto it = this->values_.find(key);
+    if (it == this->values_.end() || it->second.size() != len)
+      return false;
+    std::copy(it->second.begin(), it->second.end(), data);
+    return true;
+  }
+
+  ESPPreferenceObject make_preference(size_t length, uint32_t type, bool in_flash) override {
+    return this->make_preference(length, type);
+  }
+  ESPPreferenceObject make_preference(size_t length, uint32_t type) override;
+
+  bool sync() override {
+    if (!this->dirty_)
+      return true;
+
+    const std::string tmp_filename = this->filename_ + ".tmp";
+    FILE *file = fopen(tmp_filename.c_str(), "wb");
+    if (file == nullptr) {
+      ESP_LOGW(TAG, "Cannot open '%s' for writing", tmp_filename.c_str());
+      return false;
+    }
+    bool ok = true;
+    for (auto &it : this->values_) {
+      const uint32_t header[2] = {it.first, static_cast<uint32_t>(it.second.size())};
+      ok = ok && fwrite(header, sizeof(header), 1, file) == 1;
+      if (!it.second.empty())
+        ok = ok && fwrite(it.second.data(), it.second.size(), 1, file) == 1;
+    }
+    ok = fclose(file) == 0 && ok;
+    if (!ok || rename(tmp_filename.c_str(), this->filename_.c_str()) != 0) {
+      ESP_LOGW(TAG, "Writing preferences to '%s' failed", this->filename_.c_str());
+      remove(tmp_filename.c_str());
+      return false;
+    }
+    ESP_LOGD(TAG, "Saved %zu preferences to '%s'", this->values_.size(), this->filename_.c_str());
+    this->dirty_ = false;
+    return true;
+  }
+
+ protected:
+  std::string filename_;
+  std::map<uint32_t, std::vector<uint8_t>> values_;
+  bool dirty_{false};
+};
+
+class HostPreferenceBackend : public ESPPreferenceBackend {
+ public:
+  HostPreferenceBackend(HostPreferences *prefs, uint32_t key) : prefs_(prefs), key_(key) {}
+
+  bool save(const uint8_t *data, size_t len) override { return this->prefs_->save(this->key_, data, len); }
+  bool load(uint8_t *data, size_t len) override { return this->prefs_->load(this->key_, data, len); }
+
+ protected:
+  HostPreferences *prefs_;
+  uint32_t key_;
+};
+
+ESPPreferenceObject HostPreferences::make_preference(size_t length, uint32_t type) {
+  auto *pref = new HostPreferenceBackend(this, type);  // NOLINT(cppcoreguidelines-owning-memory)
+  return ESPPreferenceObject(pref);
+}
+
+static HostPreferences *host_preferences = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void setup_preferences(const std::string &filename) {
+  host_preferences = new HostPreferences(filename);  // NOLINT(cppcoreguidelines-owning-memory)
+  host_preferences->load_file();
+  global_preferences = host_preferences;
+}
+
+void preferences_flush() {
+  if (host_preferences != nullptr)
+    host_preferences->sync();
+}
+
+}  // namespace host
+
+ESPPreferences *global_preferences;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace esphome
+
+#endif  // USE_HOST
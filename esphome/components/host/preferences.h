@@ -0,0 +1,18 @@
+#pragma once
+
+#ifdef USE_HOST
+
+#include <string>
+
+namespace esphome {
+namespace host {
+
+/// Load the preferences from file and make them the global preferences, saves are written back to the same file.
+void setup_preferences(const std::string &filename);
+/// Write pending saves to the preferences file, used before the process is replaced or exits.
+void preferences_flush();
+
+}  // namespace host
+}  // namespace esphome
+
+#endif  // USE_HOST
@@ -11,6 +11,7 @@ static const char *const TAG = "ili9341";
 
 void ILI9341Display::setup_pins_() {
   this->init_internal_(this->get_buffer_length_());
+  this->init_frame_copy_(this->get_buffer_length_(), this->get_height_internal());
   this->dc_pin_->setup();  // OUTPUT
   this->dc_pin_->digital_write(false);
   if (this->reset_pin_ != nullptr) {
@@ -85,40 +86,35 @@ void ILI9341Display::update() {
 }
 
 void ILI9341Display::display_() {
-  // we will only update the changed window to the display
-  uint16_t w = this->x_high_ - this->x_low_ + 1;
-  uint16_t h = this->y_high_ - this->y_low_ + 1;
-
-  set_addr_window_(this->x_low_, this->y_low_, w, h);
-  this->start_data_();
-  uint32_t start_pos = ((this->y_low_ * this->width_) + x_low_);
-  for (uint16_t row = 0; row < h; row++) {
-    uint32_t pos = start_pos + (row * width_);
-    uint32_t rem = w;
-
-    while (rem > 0) {
-      uint32_t sz = buffer_to_transfer_(pos, rem);
-      this->write_array(transfer_buffer_, 2 * sz);
-      pos += sz;
-      rem -= sz;
+  // we will only update the changed windows to the display
+  for (uint8_t i = 0; i < this->dirty_count_; i++) {
+    const auto &rect = this->dirty_rects_[i];
+    uint16_t w = rect.width();
+    uint16_t h = rect.height();
+
+    set_addr_window_(rect.x1, rect.y1, w, h);
+    this->start_data_();
+    uint32_t start_pos = ((rect.y1 * this->width_) + rect.x1);
+    for (uint16_t row = 0; row < h; row++) {
+      uint32_t pos = start_pos + (row * width_);
+      uint32_t rem = w;
+
+      while (rem > 0) {
+        uint32_t sz = buffer_to_transfer_(pos, rem);
+        this->write_array(transfer_buffer_, 2 * sz);
+        pos += sz;
+        rem -= sz;
+      }
     }
+    this->end_data_();
   }
-  this->end_data_();
 
-  // invalidate watermarks
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
+  this->clear_dirty_();
 }
 
 void ILI9341Display::fill(Color color) {
   uint8_t color332 = display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
-  memset(this->buffer_, color332, this->get_buffer_length_());
-  this->x_low_ = 0;
-  this->y_low_ = 0;
-  this->x_high_ = this->get_width_internal() - 1;
-  this->y_high_ = this->get_height_internal() - 1;
+  this->fill_buffer_(&color332, 1);
 }
 
 void ILI9341Display::fill_internal_(Color color) {
@@ -148,26 +144,26 @@ void ILI9341Display::fill_internal_(Color color) {
   this->end_data_();
 
   memset(buffer_, 0, (this->get_width_internal()) * (this->get_height_internal()));
+  // display and buffer match now
+  this->clear_dirty_();
 }
 
 void HOT ILI9341Display::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (x >= this->get_width_internal() || x < 0 || y >= this->get_height_internal() || y < 0)
     return;
 
-  // low and high watermark may speed up drawing from buffer
-  this->x_low_ = (x < this->x_low_) ? x : this->x_low_;
-  this->y_low_ = (y < this->y_low_) ? y : this->y_low_;
-  this->x_high_ = (x > this->x_high_) ? x : this->x_high_;
-  this->y_high_ = (y > this->y_high_) ? y : this->y_high_;
-
   uint32_t pos = (y * width_) + x;
+  uint8_t value;
   if (this->buffer_color_mode_ == BITS_8) {
-    uint8_t color332 = display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
-    buffer_[pos] = color332;
+    value = display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
   } else {  // if (this->buffer_color_mode_ == BITS_8_INDEXED) {
-    uint8_t index = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
-    buffer_[pos] = index;
+    value = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
   }
+  // only changed pixels are sent to the display
+  if (buffer_[pos] == value)
+    return;
+  buffer_[pos] = value;
+  this->mark_dirty_(x, y);
 }
 
 // should return the total size: return this->get_width_internal() * this->get_height_internal() * 2 // 16bit color
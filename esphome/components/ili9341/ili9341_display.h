@@ -65,10 +65,6 @@ class ILI9341Display : public PollingComponent,
   ILI9341Model model_;
   int16_t width_{320};   ///< Display width as modified by current rotation
   int16_t height_{240};  ///< Display height as modified by current rotation
-  uint16_t x_low_{0};
-  uint16_t y_low_{0};
-  uint16_t x_high_{0};
-  uint16_t y_high_{0};
   const uint8_t *palette_;
 
   ILI9341ColorMode buffer_color_mode_{BITS_8};
@@ -0,0 +1,170 @@
+#include "json_writer.h"
+#include "esphome/core/log.h"
+
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace esphome {
+namespace json {
+
+static const char *const TAG = "json";
+
+bool JsonWriter::separate_() {
+  if (this->failed_)
+    return false;
+  if (this->after_key_) {
+    this->after_key_ = false;
+    return true;
+  }
+  if (this->depth_ == 0)
+    return true;
+  const uint32_t bit = 1UL << (this->depth_ - 1);
+  if (this->has_members_ & bit)
+    this->output_ += ',';
+  this->has_members_ |= bit;
+  return true;
+}
+
+JsonWriter &JsonWriter::begin_(char bracket) {
+  if (!this->separate_())
+    return *this;
+  if (this->depth_ == MAX_DEPTH) {
+    ESP_LOGE(TAG, "JSON nested deeper than %u levels", MAX_DEPTH);
+    this->failed_ = true;
+    return *this;
+  }
+  this->output_ += bracket;
+  this->depth_++;
+  this->has_members_ &= ~(1UL << (this->depth_ - 1));
+  return *this;
+}
+JsonWriter &JsonWriter::end_(char bracket) {
+  if (this->failed_ || this->depth_ == 0)
+    return *this;
+  this->depth_--;
+  this->output_ += bracket;
+  return *this;
+}
+JsonWriter &JsonWriter::begin_object() { return this->begin_('{'); }
+JsonWriter &JsonWriter::end_object() { return this->end_('}'); }
+JsonWriter &JsonWriter::begin_array() { return this->begin_('['); }
+JsonWriter &JsonWriter::end_array() { return this->end_(']'); }
+
+JsonWriter &JsonWriter::key(const char *key) {
+  if (!this->separate_())
+    return *this;
+  this->output_ += '"';
+  this->escaped_(key, strlen(key));
+  this->output_ += "\":";
+  this->after_key_ = true;
+  return *this;
+}
+
+JsonWriter &JsonWriter::value(const char *value) {
+  if (value == nullptr)
+    return this->value(nullptr);
+  return this->value_(value, strlen(value));
+}
+JsonWriter &JsonWriter::value(const char *prefix, const std::string &value) {
+  if (!this->separate_())
+    return *this;
+  this->output_ += '"';
+  this->escaped_(prefix, strlen(prefix));
+  this->escaped_(value.data(), value.size());
+  this->output_ += '"';
+  return *this;
+}
+JsonWriter &JsonWriter::value_(const char *value, size_t len) {
+  if (!this->separate_())
+    return *this;
+  this->output_ += '"';
+  this->escaped_(value, len);
+  this->output_ += '"';
+  return *this;
+}
+JsonWriter &JsonWriter::value(bool value) {
+  if (!this->separate_())
+    return *this;
+  this->output_ += value ? "true" : "false";
+  return *this;
+}
+JsonWriter &JsonWriter::value(float value) { return this->number_("%.7g", value); }
+JsonWriter &JsonWriter::value(double value) { return this->number_("%.17g", value); }
+JsonWriter &JsonWriter::number_(const char *format, double value) {
+  if (std::isnan(value) || std::isinf(value))
+    return this->value(nullptr);
+  if (!this->separate_())
+    return *this;
+  char buf[32];
+  int len = snprintf(buf, sizeof(buf), format, value);
+  this->output_.append(buf, len);
+  return *this;
+}
+JsonWriter &JsonWriter::value(std::nullptr_t) {
+  if (!this->separate_())
+    return *this;
+  this->output_ += "null";
+  return *this;
+}
+JsonWriter &JsonWriter::int_(int64_t value) {
+  if (!this->separate_())
+    return *this;
+  char buf[24];
+  int len = snprintf(buf, sizeof(buf), "%" PRId64, value);
+  this->output_.append(buf, len);
+  return *this;
+}
+JsonWriter &JsonWriter::uint_(uint64_t value) {
+  if (!this->separate_())
+    return *this;
+  char buf[24];
+  int len = snprintf(buf, sizeof(buf), "%" PRIu64, value);
+  this->output_.append(buf, len);
+  return *this;
+}
+
+void JsonWriter::escaped_(const char *value, size_t len) {
+  static const char *const HEX = "0123456789abcdef";
+  size_t start = 0;
+  for (size_t i = 0; i < len; i++) {
+    const uint8_t c = value[i];
+    if (c >= 0x20 && c != '"' && c != '\\')
+      continue;
+    // Copy the run of plain characters at once
+    this->output_.append(value + start, i - start);
+    start = i + 1;
+    this->output_ += '\\';
+    switch (c) {
+      case '"':
+      case '\\':
+        this->output_ += char(c);
+        break;
+      case '\n':
+        this->output_ += 'n';
+        break;
+      case '\r':
+        this->output_ += 'r';
+        break;
+      case '\t':
+        this->output_ += 't';
+        break;
+      case '\b':
+        this->output_ += 'b';
+        break;
+      case '\f':
+        this->output_ += 'f';
+        break;
+      default:
+        this->output_ += "u00";
+        this->output_ += HEX[c >> 4];
+        this->output_ += HEX[c & 0xF];
+        break;
+    }
+  }
+  this->output_.append(value + start, len - start);
+}
+
+}  // namespace json
+}  // namespace esphome
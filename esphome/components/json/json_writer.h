@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace esphome {
+namespace json {
+
+/** Streaming JSON serializer.
+ *
+ * Appends to a string supplied by the caller instead of building a document first, so a message costs at most the
+ * growth of that string (none if the caller reuses it). Commas between members are inserted automatically and
+ * strings are escaped. Floats are written with up to 7 significant digits, doubles with 17, NaN and infinity as
+ * null. Objects and arrays can be nested MAX_DEPTH levels deep: beginning one more marks the writer as failed, and it
+ * ignores everything written after that (see has_failed()).
+ *
+ * @code
+ * std::string output;
+ * json::JsonWriter json(output);
+ * json.begin_object();
+ * json.add("id", "sensor-temperature");
+ * json.add("value", 21.5f);
+ * json.begin_array("options").value("a").value("b").end_array();
+ * json.end_object();
+ * @endcode
+ */
+class JsonWriter {
+ public:
+  static const uint8_t MAX_DEPTH = 32;
+
+  explicit JsonWriter(std::string &output) : output_(output) {}
+
+  JsonWriter &begin_object();
+  /// Begin an object as member of the current object.
+  JsonWriter &begin_object(const char *key) { return this->key(key).begin_object(); }
+  JsonWriter &end_object();
+  JsonWriter &begin_array();
+  /// Begin an array as member of the current object.
+  JsonWriter &begin_array(const char *key) { return this->key(key).begin_array(); }
+  JsonWriter &end_array();
+
+  /// Write the key of the next member of the current object, followed by exactly one value.
+  JsonWriter &key(const char *key);
+
+  JsonWriter &value(const char *value);
+  JsonWriter &value(const std::string &value) { return this->value_(value.data(), value.size()); }
+  /// Write a string made of two parts (e.g. a prefix and an object id) without joining them first.
+  JsonWriter &value(const char *prefix, const std::string &value);
+  JsonWriter &value(bool value);
+  JsonWriter &value(float value);
+  JsonWriter &value(double value);
+  JsonWriter &value(std::nullptr_t);
+  template<typename T,
+           typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value, int>::type = 0>
+  JsonWriter &value(T value) {
+    if (std::is_signed<T>::value)
+      return this->int_(static_cast<int64_t>(value));
+    return this->uint_(static_cast<uint64_t>(value));
+  }
+
+  /// Write a member of the current object.
+  template<typename T> JsonWriter &add(const char *key, T &&value) {
+    return this->key(key).value(std::forward<T>(value));
+  }
+
+  /// Whether the nesting got deeper than MAX_DEPTH, the output is incomplete then.
+  bool has_failed() const { return this->failed_; }
+
+ protected:
+  /// Write a separator if needed before the next key or value, returns false if nothing may be written.
+  bool separate_();
+  JsonWriter &begin_(char bracket);
+  JsonWriter &end_(char bracket);
+  JsonWriter &number_(const char *format, double value);
+  JsonWriter &value_(const char *value, size_t len);
+  JsonWriter &int_(int64_t value);
+  JsonWriter &uint_(uint64_t value);
+  void escaped_(const char *value, size_t len);
+
+  std::string &output_;
+  /// One bit per nesting level, set once the level has a member.
+  uint32_t has_members_{0};
+  uint8_t depth_{0};
+  bool after_key_{false};
+  bool failed_{false};
+};
+
+/// Build a JSON object with the provided writer function, without an intermediate document. Returns an empty
+/// string if the writer failed.
+template<typename F> std::string write_json(F &&f, size_t reserve = 128) {
+  std::string output;
+  output.reserve(reserve);
+  JsonWriter json(output);
+  json.begin_object();
+  f(json);
+  json.end_object();
+  if (json.has_failed())
+    output.clear();
+  return output;
+}
+
+}  // namespace json
+}  // namespace esphome
@@ -1,14 +1,24 @@
 #include "addressable_light.h"
 #include "esphome/core/log.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
 
 namespace esphome {
 namespace light {
 
 static const char *const TAG = "light.addressable";
 
+/// Period of the frame statistics, frequent enough to relate drops to what the light was doing.
+static const uint32_t FRAME_STATS_INTERVAL_MS = 60000;
+
 void AddressableLight::call_setup() {
   this->setup();
 
+#ifdef ESPHOME_LOG_HAS_DEBUG
+  this->set_interval("frame_stats", FRAME_STATS_INTERVAL_MS, [this]() { this->log_frame_stats_(); });
+#endif
+
 #ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
   this->set_interval(5000, [this]() {
     const char *name = this->state_parent_ == nullptr ? "" : this->state_parent_->get_name().c_str();
@@ -23,6 +33,18 @@ void AddressableLight::call_setup() {
 #endif
 }
 
+void AddressableLight::log_frame_stats_() {
+  const uint32_t shown = this->frames_shown_ - this->frames_shown_logged_;
+  const uint32_t dropped = this->frames_dropped_ - this->frames_dropped_logged_;
+  if (shown == 0 && dropped == 0)
+    return;
+  this->frames_shown_logged_ = this->frames_shown_;
+  this->frames_dropped_logged_ = this->frames_dropped_;
+  const char *name = this->state_parent_ == nullptr ? "" : this->state_parent_->get_name().c_str();
+  ESP_LOGD(TAG, "'%s': %u frames shown, %u dropped in the last %us (%u shown, %u dropped since boot)", name, shown,
+           dropped, FRAME_STATS_INTERVAL_MS / 1000, this->frames_shown_, this->frames_dropped_);
+}
+
 std::unique_ptr<LightTransformer> AddressableLight::create_default_transition() {
   return make_unique<AddressableLightTransformer>(*this);
 }
@@ -35,6 +57,98 @@ Color color_from_light_color_values(LightColorValues val) {
   return Color(r, g, b, w);
 }
 
+void AddressableLight::fill(int32_t begin, int32_t end, const Color &color) {
+  end = std::min(end, this->size());
+  // Correct once, every LED gets the same bytes
+  const Color corrected = this->correction_.color_correct(color);
+  ESPPixelSpan span;
+  while (begin < end) {
+    if (!this->get_span_internal(begin, end - begin, &span)) {
+      this->get_view_internal(begin++).set(color);
+      continue;
+    }
+    for (int32_t i = 0; i < span.size; i++)
+      span.set_raw(span.at(i), corrected);
+    begin += span.size;
+  }
+}
+
+void AddressableLight::blend(int32_t begin, int32_t end, const Color &color, uint8_t amount) {
+  const Color add = color * amount;
+  const uint8_t keep = 255 - amount;
+  this->transform(begin, end, [add, keep](Color current) { return add + current * keep; });
+}
+
+void AddressableLight::copy_from(int32_t begin, const uint8_t *data, int32_t count, uint8_t channels) {
+  const int32_t end = std::min(begin + count, this->size());
+  ESPPixelSpan span;
+  while (begin < end) {
+    if (!this->get_span_internal(begin, end - begin, &span)) {
+      this->get_view_internal(begin++).set(Color(data[0], data[1], data[2], channels == 4 ? data[3] : 0));
+      data += channels;
+      continue;
+    }
+    for (int32_t i = 0; i < span.size; i++, data += channels) {
+      const Color color(data[0], data[1], data[2], channels == 4 ? data[3] : 0);
+      span.set_raw(span.at(i), this->correction_.color_correct(color));
+    }
+    begin += span.size;
+  }
+}
+
+bool AddressableLight::move_raw_(int32_t dst, int32_t src, int32_t count) {
+  if (count <= 0)
+    return true;
+  // Only when all LEDs are in one buffer, moving between spans isn't worth the complexity
+  ESPPixelSpan span;
+  if (!this->get_span_internal(0, this->size(), &span) || span.size != this->size())
+    return false;
+  memmove(span.at(dst), span.at(src), count * span.stride);
+  return true;
+}
+
+void AddressableLight::shift_left(int32_t amnt) {
+  if (amnt < 0) {
+    this->shift_right(-amnt);
+    return;
+  }
+  if (amnt > this->size())
+    amnt = this->size();
+  this->range(0, -amnt) = this->range(amnt, this->size());
+}
+void AddressableLight::shift_right(int32_t amnt) {
+  if (amnt < 0) {
+    this->shift_left(-amnt);
+    return;
+  }
+  if (amnt > this->size())
+    amnt = this->size();
+  this->range(amnt, this->size()) = this->range(0, -amnt);
+}
+void AddressableLight::rotate_left(int32_t amnt) {
+  const int32_t size = this->size();
+  if (size == 0)
+    return;
+  amnt %= size;
+  if (amnt < 0)
+    amnt += size;
+  if (amnt == 0)
+    return;
+
+  ESPPixelSpan span;
+  if (this->get_span_internal(0, size, &span) && span.size == size) {
+    std::rotate(span.pixels, span.at(amnt), span.at(size));
+    return;
+  }
+  // Keep the LEDs that wrap around, shift the others and put them back at the end
+  std::vector<Color> wrapped(amnt);
+  for (int32_t i = 0; i < amnt; i++)
+    wrapped[i] = this->get(i).get();
+  this->shift_left(amnt);
+  for (int32_t i = 0; i < amnt; i++)
+    this->get(size - amnt + i).set(wrapped[i]);
+}
+
 void AddressableLight::update_state(LightState *state) {
   auto val = state->current_values;
   auto max_brightness = to_uint8_scale(val.get_brightness() * val.get_state());
@@ -96,11 +210,7 @@ optional<LightColorValues> AddressableLightTransformer::apply() {
   auto alpha8 = static_cast<uint8_t>(alpha255);
 
   if (alpha8 != 0) {
-    uint8_t inv_alpha8 = 255 - alpha8;
-    Color add = this->target_color_ * alpha8;
-
-    for (auto led : this->light_)
-      led.set(add + led.get() * inv_alpha8);
+    this->light_.blend(0, this->light_.size(), this->target_color_, alpha8);
   }
 
   this->last_transition_progress_ = smoothed_progress;
@@ -28,6 +28,42 @@ class AddressableLightState : public LightState {
   using LightState::LightState;
 };
 
+/** Consecutive LEDs stored at a fixed stride in the buffer of an output.
+ *
+ * Used by the bulk operations of AddressableLight: the position of the channels is resolved once per span, instead of
+ * creating a view (through a virtual call) for every LED. Values in the buffer are color corrected.
+ */
+struct ESPPixelSpan {
+  uint8_t *pixels{nullptr};
+  /// Bytes from one LED to the next.
+  uint8_t stride{0};
+  /// Offsets of the channels within a LED, white is negative if the LEDs have no white channel.
+  uint8_t red{0};
+  uint8_t green{0};
+  uint8_t blue{0};
+  int8_t white{-1};
+  /// Effect data of the first LED (one byte per LED), nullptr if not supported.
+  uint8_t *effect_data{nullptr};
+  int32_t size{0};
+
+  uint8_t *at(int32_t index) const { return this->pixels + index * this->stride; }
+  Color get_raw(const uint8_t *pixel) const {
+    return Color(pixel[this->red], pixel[this->green], pixel[this->blue], this->white < 0 ? 0 : pixel[this->white]);
+  }
+  void set_raw(uint8_t *pixel, const Color &color) const {
+    pixel[this->red] = color.red;
+    pixel[this->green] = color.green;
+    pixel[this->blue] = color.blue;
+    if (this->white >= 0)
+      pixel[this->white] = color.white;
+  }
+  void set_raw_rgb(uint8_t *pixel, const Color &color) const {
+    pixel[this->red] = color.red;
+    pixel[this->green] = color.green;
+    pixel[this->blue] = color.blue;
+  }
+};
+
 class AddressableLight : public LightOutput, public Component {
  public:
   virtual int32_t size() const = 0;
@@ -42,23 +78,42 @@ class AddressableLight : public LightOutput, public Component {
   ESPRangeView all() { return ESPRangeView(this, 0, this->size()); }
   ESPRangeIterator begin() { return this->all().begin(); }
   ESPRangeIterator end() { return this->all().end(); }
-  void shift_left(int32_t amnt) {
-    if (amnt < 0) {
-      this->shift_right(-amnt);
-      return;
-    }
-    if (amnt > this->size())
-      amnt = this->size();
-    this->range(0, -amnt) = this->range(amnt, this->size());
+  void shift_left(int32_t amnt);
+  void shift_right(int32_t amnt);
+  void rotate_left(int32_t amnt);
+  void rotate_right(int32_t amnt) { this->rotate_left(-amnt); }
+
+  // Bulk operations on the LEDs [begin, end), much faster than going through a view for each LED.
+  /// Set the LEDs to one color.
+  void fill(int32_t begin, int32_t end, const Color &color);
+  /// Move the LEDs towards a color, by amount/255.
+  void blend(int32_t begin, int32_t end, const Color &color, uint8_t amount);
+  /// Set count LEDs from begin on from a buffer of RGB (channels = 3) or RGBW (channels = 4) values.
+  void copy_from(int32_t begin, const uint8_t *data, int32_t count, uint8_t channels = 3);
+  /// Raw access to the buffer of LEDs from index on, for outputs wrapping other outputs. See get_span_internal().
+  bool get_span(int32_t index, int32_t max_size, ESPPixelSpan *span) const {
+    return this->get_span_internal(index, max_size, span);
   }
-  void shift_right(int32_t amnt) {
-    if (amnt < 0) {
-      this->shift_left(-amnt);
-      return;
+  /// Set each LED to f(effect_data), f may change the effect data of the LED it's called for.
+  template<typename F> void generate(int32_t begin, int32_t end, F &&f) { this->generate_<true>(begin, end, f); }
+  /// Like generate(), but only the RGB channels are set, the white channel keeps its value.
+  template<typename F> void generate_rgb(int32_t begin, int32_t end, F &&f) { this->generate_<false>(begin, end, f); }
+  /// Replace the color of each LED with f(color).
+  template<typename F> void transform(int32_t begin, int32_t end, F &&f) {
+    ESPPixelSpan span;
+    while (begin < end) {
+      if (!this->get_span_internal(begin, end - begin, &span)) {
+        auto view = this->get_view_internal(begin++);
+        view.set(f(view.get()));
+        continue;
+      }
+      for (int32_t i = 0; i < span.size; i++) {
+        uint8_t *pixel = span.at(i);
+        const Color color = this->correction_.color_uncorrect(span.get_raw(pixel));
+        span.set_raw(pixel, this->correction_.color_correct(f(color)));
+      }
+      begin += span.size;
     }
-    if (amnt > this->size())
-      amnt = this->size();
-    this->range(amnt, this->size()) = this->range(0, -amnt);
   }
   // Indicates whether an effect that directly updates the output buffer is active to prevent overwriting
   bool is_effect_active() const { return this->effect_active_; }
@@ -73,7 +128,7 @@ class AddressableLight : public LightOutput, public Component {
     this->state_parent_ = state;
   }
   void update_state(LightState *state) override;
-  void schedule_show() { this->state_parent_->next_write_ = true; }
+  void schedule_show() { this->state_parent_->schedule_write_(); }
 
 #ifdef USE_POWER_SUPPLY
   void set_power_supply(power_supply::PowerSupply *power_supply) { this->power_.set_parent(power_supply); }
@@ -81,8 +136,20 @@ class AddressableLight : public LightOutput, public Component {
 
   void call_setup() override;
 
+  /// Number of frames sent to the strip.
+  uint32_t get_frames_shown() const { return this->frames_shown_; }
+  /// Number of frames replaced by a newer one before the strip (or the refresh rate) was ready for them.
+  uint32_t get_frames_dropped() const { return this->frames_dropped_; }
+
  protected:
   friend class AddressableLightTransformer;
+  friend class ESPRangeView;
+
+  /// Count frames for the statistics that are logged every FRAME_STATS_INTERVAL_MS, called by the outputs.
+  void count_frame_shown_() { this->frames_shown_++; }
+  void count_frame_dropped_() { this->frames_dropped_++; }
+  /// Log the frames shown and dropped since the last call, if there were any.
+  virtual void log_frame_stats_();
 
   void mark_shown_() {
 #ifdef USE_POWER_SUPPLY
@@ -96,6 +163,40 @@ class AddressableLight : public LightOutput, public Component {
 #endif
   }
   virtual ESPColorView get_view_internal(int32_t index) const = 0;
+  /** Get the LEDs from index on that are stored contiguously, at most max_size of them.
+   *
+   * Outputs with a pixel buffer override this to speed up the bulk operations, the default makes them fall back to
+   * get_view_internal().
+   */
+  virtual bool get_span_internal(int32_t index, int32_t max_size, ESPPixelSpan *span) const { return false; }
+  /// Copy the raw values of count LEDs (overlapping is fine), false if the LEDs aren't in a single buffer.
+  bool move_raw_(int32_t dst, int32_t src, int32_t count);
+  template<bool WHITE, typename F> void generate_(int32_t begin, int32_t end, F &f) {
+    ESPPixelSpan span;
+    while (begin < end) {
+      if (!this->get_span_internal(begin, end - begin, &span)) {
+        auto view = this->get_view_internal(begin++);
+        uint8_t effect_data = view.get_effect_data();
+        const Color color = f(effect_data);
+        if (WHITE)
+          view.set(color);
+        else
+          view.set_rgb(color.r, color.g, color.b);
+        view.set_effect_data(effect_data);
+        continue;
+      }
+      uint8_t no_effect_data;
+      for (int32_t i = 0; i < span.size; i++) {
+        uint8_t &effect_data = span.effect_data != nullptr ? span.effect_data[i] : (no_effect_data = 0);
+        const Color color = this->correction_.color_correct(f(effect_data));
+        if (WHITE)
+          span.set_raw(span.at(i), color);
+        else
+          span.set_raw_rgb(span.at(i), color);
+      }
+      begin += span.size;
+    }
+  }
 
   bool effect_active_{false};
   ESPColorCorrection correction_{};
@@ -103,6 +204,10 @@ class AddressableLight : public LightOutput, public Component {
   power_supply::PowerSupplyRequester power_;
 #endif
   LightState *state_parent_{nullptr};
+  uint32_t frames_shown_{0};
+  uint32_t frames_dropped_{0};
+  uint32_t frames_shown_logged_{0};
+  uint32_t frames_dropped_logged_{0};
 };
 
 class AddressableLightTransformer : public LightTransitionTransformer {
@@ -80,11 +80,12 @@ class AddressableRainbowLightEffect : public AddressableLightEffect {
     hsv.saturation = 240;
     uint16_t hue = (millis() * this->speed_) % 0xFFFF;
     const uint16_t add = 0xFFFF / this->width_;
-    for (auto var : it) {
+    // only the RGB channels are part of the rainbow, the white channel is neither read back nor changed
+    it.generate_rgb(0, it.size(), [&hsv, &hue, add](uint8_t &) {
       hsv.hue = hue >> 8;
-      var = hsv;
       hue += add;
-    }
+      return hsv.to_rgb();
+    });
     it.schedule_show();
   }
   void set_speed(uint32_t speed) { this->speed_ = speed; }
@@ -166,10 +167,8 @@ class AddressableScanEffect : public AddressableLightEffect {
     }
     this->last_move_ = now;
 
-    it.all() = Color::BLACK;
-    for (uint32_t i = 0; i < this->scan_width_; i++) {
-      it[this->at_led_ + i] = current_color;
-    }
+    it.fill(0, it.size(), Color::BLACK);
+    it.fill(this->at_led_, this->at_led_ + this->scan_width_, current_color);
 
     it.schedule_show();
   }
@@ -193,19 +192,14 @@ class AddressableTwinkleEffect : public AddressableLightEffect {
       pos_add = pos_add32;
       this->last_progress_ += pos_add32 * this->progress_interval_;
     }
-    for (auto view : addressable) {
-      if (view.get_effect_data() != 0) {
-        const uint8_t sine = half_sin8(view.get_effect_data());
-        view = current_color * sine;
-        const uint8_t new_pos = view.get_effect_data() + pos_add;
-        if (new_pos < view.get_effect_data())
-          view.set_effect_data(0);
-        else
-          view.set_effect_data(new_pos);
-      } else {
-        view = Color::BLACK;
-      }
-    }
+    addressable.generate(0, addressable.size(), [&current_color, pos_add](uint8_t &effect_data) {
+      if (effect_data == 0)
+        return Color::BLACK;
+      const uint8_t sine = half_sin8(effect_data);
+      const uint8_t new_pos = effect_data + pos_add;
+      effect_data = new_pos < effect_data ? 0 : new_pos;
+      return current_color * sine;
+    });
     while (random_float() < this->twinkle_probability_) {
       const size_t pos = random_uint32() % addressable.size();
       if (addressable[pos].get_effect_data() != 0)
@@ -234,25 +228,18 @@ class AddressableRandomTwinkleEffect : public AddressableLightEffect {
       this->last_progress_ = now;
     }
     uint8_t subsine = ((8 * (now - this->last_progress_)) / this->progress_interval_) & 0b111;
-    for (auto view : it) {
-      if (view.get_effect_data() != 0) {
-        const uint8_t x = (view.get_effect_data() >> 3) & 0b11111;
-        const uint8_t color = view.get_effect_data() & 0b111;
-        const uint16_t sine = half_sin8((x << 3) | subsine);
-        if (color == 0) {
-          view = current_color * sine;
-        } else {
-          view = Color(((color >> 2) & 1) * sine, ((color >> 1) & 1) * sine, ((color >> 0) & 1) * sine);
-        }
-        const uint8_t new_x = x + pos_add;
-        if (new_x > 0b11111)
-          view.set_effect_data(0);
-        else
-          view.set_effect_data((new_x << 3) | color);
-      } else {
-        view = Color(0, 0, 0, 0);
-      }
-    }
+    it.generate(0, it.size(), [&current_color, pos_add, subsine](uint8_t &effect_data) {
+      if (effect_data == 0)
+        return Color(0, 0, 0, 0);
+      const uint8_t x = (effect_data >> 3) & 0b11111;
+      const uint8_t color = effect_data & 0b111;
+      const uint16_t sine = half_sin8((x << 3) | subsine);
+      const uint8_t new_x = x + pos_add;
+      effect_data = new_x > 0b11111 ? 0 : (new_x << 3) | color;
+      if (color == 0)
+        return current_color * sine;
+      return Color(((color >> 2) & 1) * sine, ((color >> 1) & 1) * sine, ((color >> 0) & 1) * sine);
+    });
     while (random_float() < this->twinkle_probability_) {
       const size_t pos = random_uint32() % it.size();
       if (it[pos].get_effect_data() != 0)
@@ -276,7 +263,7 @@ class AddressableFireworksEffect : public AddressableLightEffect {
   explicit AddressableFireworksEffect(const std::string &name) : AddressableLightEffect(name) {}
   void start() override {
     auto &it = *this->get_addressable_();
-    it.all() = Color::BLACK;
+    it.fill(0, it.size(), Color::BLACK);
   }
   void apply(AddressableLight &it, const Color &current_color) override {
     const uint32_t now = millis();
@@ -285,12 +272,12 @@ class AddressableFireworksEffect : public AddressableLightEffect {
     this->last_update_ = now;
     // "invert" the fade out parameter so that higher values make fade out faster
     const uint8_t fade_out_mult = 255u - this->fade_out_rate_;
-    for (auto view : it) {
-      Color target = view.get() * fade_out_mult;
+    it.transform(0, it.size(), [fade_out_mult](Color color) {
+      Color target = color * fade_out_mult;
       if (target.r < 64)
         target *= 170;
-      view = target;
-    }
+      return target;
+    });
     int last = it.size() - 1;
     it[0].set(it[0].get() + (it[1].get() * 128));
     for (int i = 1; i < last; i++) {
@@ -332,15 +319,16 @@ class AddressableFlickerEffect : public AddressableLightEffect {
 
     this->last_update_ = now;
     uint32_t rng_state = random_uint32();
-    for (auto var : it) {
+    const Color target = current_color * intensity;
+    it.transform(0, it.size(), [&rng_state, intensity, inv_intensity, &target](Color color) {
       rng_state = (rng_state * 0x9E3779B9) + 0x9E37;
       const uint8_t flicker = (rng_state & 0xFF) % intensity;
       // scale down by random factor
-      var = var.get() * (255 - flicker);
+      color = color * (255 - flicker);
 
       // slowly fade back to "real" value
-      var = (var.get() * inv_intensity) + (current_color * intensity);
-    }
+      return (color * inv_intensity) + target;
+    });
     it.schedule_show();
   }
   void set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
@@ -5,6 +5,15 @@
 namespace esphome {
 namespace light {
 
+ESPColorCorrection::ESPColorCorrection() : max_brightness_(255, 255, 255, 255) {
+  // No correction until the gamma is set
+  for (uint16_t i = 0; i < 256; i++) {
+    this->gamma_table_[i] = i;
+    this->gamma_reverse_table_[i] = i;
+  }
+  this->update_tables_();
+}
+
 void ESPColorCorrection::calculate_gamma_table(float gamma) {
   for (uint16_t i = 0; i < 256; i++) {
     // corrected = val ^ gamma
@@ -14,12 +23,56 @@ void ESPColorCorrection::calculate_gamma_table(float gamma) {
   if (gamma == 0.0f) {
     for (uint16_t i = 0; i < 256; i++)
       this->gamma_reverse_table_[i] = i;
+  } else {
+    for (uint16_t i = 0; i < 256; i++) {
+      // val = corrected ^ (1/gamma)
+      auto uncorrected = to_uint8_scale(powf(i / 255.0f, 1.0f / gamma));
+      this->gamma_reverse_table_[i] = uncorrected;
+    }
+  }
+  this->update_tables_();
+}
+
+void ESPColorCorrection::set_max_brightness(const Color &max_brightness) {
+  if (max_brightness.raw_32 == this->max_brightness_.raw_32)
     return;
+  this->max_brightness_ = max_brightness;
+  this->update_tables_();
+}
+
+void ESPColorCorrection::update_tables_() {
+  // Channels with the same maximum brightness share a table
+  uint8_t table_of[4];
+  uint8_t count = 0;
+  for (uint8_t channel = 0; channel < 4; channel++) {
+    table_of[channel] = count;
+    for (uint8_t other = 0; other < channel; other++) {
+      if (this->max_brightness_.raw[other] == this->max_brightness_.raw[channel]) {
+        table_of[channel] = table_of[other];
+        break;
+      }
+    }
+    if (table_of[channel] == count)
+      count++;
   }
-  for (uint16_t i = 0; i < 256; i++) {
-    // val = corrected ^ (1/gamma)
-    auto uncorrected = to_uint8_scale(powf(i / 255.0f, 1.0f / gamma));
-    this->gamma_reverse_table_[i] = uncorrected;
+  if (count != this->table_count_) {
+    this->tables_.reset(new uint8_t[count * 256]);  // NOLINT(cppcoreguidelines-owning-memory)
+    this->table_count_ = count;
+  }
+
+  uint8_t filled = 0;
+  for (uint8_t channel = 0; channel < 4; channel++) {
+    const uint8_t max_brightness = this->max_brightness_.raw[channel];
+    uint8_t *table = &this->tables_[table_of[channel] * 256];
+    this->correct_table_[channel] = table;
+    if (table_of[channel] == filled) {
+      for (uint16_t i = 0; i < 256; i++)
+        table[i] = this->gamma_table_[esp_scale8(esp_scale8(i, max_brightness), this->local_brightness_)];
+      filled++;
+    }
+
+    const uint32_t divisor = uint32_t(max_brightness) * this->local_brightness_;
+    this->uncorrect_scale_[channel] = divisor == 0 ? 0 : (255UL * 255UL * 256UL) / divisor;
   }
 }
 
@@ -2,73 +2,66 @@
 
 #include "esphome/core/color.h"
 
+#include <memory>
+
 namespace esphome {
 namespace light {
 
+/** Gamma and brightness correction of addressable LEDs.
+ *
+ * Writing a LED costs one table lookup per channel: the tables combine gamma with the maximum brightness of the
+ * channel and the local brightness, and are only rebuilt when one of those changes. Channels with the same maximum
+ * brightness share a table, so the tables take 256 bytes per distinct value on the heap: 256 bytes with the default
+ * color_correct, at most 1 KB. Every addressable light has its own instance, partitions included, because their
+ * gamma and brightness are independent of the lights they are made of.
+ */
 class ESPColorCorrection {
  public:
-  ESPColorCorrection() : max_brightness_(255, 255, 255, 255) {}
-  void set_max_brightness(const Color &max_brightness) { this->max_brightness_ = max_brightness; }
-  void set_local_brightness(uint8_t local_brightness) { this->local_brightness_ = local_brightness; }
+  ESPColorCorrection();
+  void set_max_brightness(const Color &max_brightness);
+  void set_local_brightness(uint8_t local_brightness) {
+    if (local_brightness == this->local_brightness_)
+      return;
+    this->local_brightness_ = local_brightness;
+    this->update_tables_();
+  }
   void calculate_gamma_table(float gamma);
   inline Color color_correct(Color color) const ALWAYS_INLINE {
     // corrected = (uncorrected * max_brightness * local_brightness) ^ gamma
     return Color(this->color_correct_red(color.red), this->color_correct_green(color.green),
                  this->color_correct_blue(color.blue), this->color_correct_white(color.white));
   }
-  inline uint8_t color_correct_red(uint8_t red) const ALWAYS_INLINE {
-    uint8_t res = esp_scale8(esp_scale8(red, this->max_brightness_.red), this->local_brightness_);
-    return this->gamma_table_[res];
-  }
-  inline uint8_t color_correct_green(uint8_t green) const ALWAYS_INLINE {
-    uint8_t res = esp_scale8(esp_scale8(green, this->max_brightness_.green), this->local_brightness_);
-    return this->gamma_table_[res];
-  }
-  inline uint8_t color_correct_blue(uint8_t blue) const ALWAYS_INLINE {
-    uint8_t res = esp_scale8(esp_scale8(blue, this->max_brightness_.blue), this->local_brightness_);
-    return this->gamma_table_[res];
-  }
-  inline uint8_t color_correct_white(uint8_t white) const ALWAYS_INLINE {
-    uint8_t res = esp_scale8(esp_scale8(white, this->max_brightness_.white), this->local_brightness_);
-    return this->gamma_table_[res];
-  }
+  inline uint8_t color_correct_red(uint8_t red) const ALWAYS_INLINE { return this->correct_table_[0][red]; }
+  inline uint8_t color_correct_green(uint8_t green) const ALWAYS_INLINE { return this->correct_table_[1][green]; }
+  inline uint8_t color_correct_blue(uint8_t blue) const ALWAYS_INLINE { return this->correct_table_[2][blue]; }
+  inline uint8_t color_correct_white(uint8_t white) const ALWAYS_INLINE { return this->correct_table_[3][white]; }
   inline Color color_uncorrect(Color color) const ALWAYS_INLINE {
     // uncorrected = corrected^(1/gamma) / (max_brightness * local_brightness)
     return Color(this->color_uncorrect_red(color.red), this->color_uncorrect_green(color.green),
                  this->color_uncorrect_blue(color.blue), this->color_uncorrect_white(color.white));
   }
-  inline uint8_t color_uncorrect_red(uint8_t red) const ALWAYS_INLINE {
-    if (this->max_brightness_.red == 0 || this->local_brightness_ == 0)
-      return 0;
-    uint16_t uncorrected = this->gamma_reverse_table_[red] * 255UL;
-    uint8_t res = ((uncorrected / this->max_brightness_.red) * 255UL) / this->local_brightness_;
-    return res;
-  }
-  inline uint8_t color_uncorrect_green(uint8_t green) const ALWAYS_INLINE {
-    if (this->max_brightness_.green == 0 || this->local_brightness_ == 0)
-      return 0;
-    uint16_t uncorrected = this->gamma_reverse_table_[green] * 255UL;
-    uint8_t res = ((uncorrected / this->max_brightness_.green) * 255UL) / this->local_brightness_;
-    return res;
-  }
-  inline uint8_t color_uncorrect_blue(uint8_t blue) const ALWAYS_INLINE {
-    if (this->max_brightness_.blue == 0 || this->local_brightness_ == 0)
-      return 0;
-    uint16_t uncorrected = this->gamma_reverse_table_[blue] * 255UL;
-    uint8_t res = ((uncorrected / this->max_brightness_.blue) * 255UL) / this->local_brightness_;
-    return res;
-  }
-  inline uint8_t color_uncorrect_white(uint8_t white) const ALWAYS_INLINE {
-    if (this->max_brightness_.white == 0 || this->local_brightness_ == 0)
-      return 0;
-    uint16_t uncorrected = this->gamma_reverse_table_[white] * 255UL;
-    uint8_t res = ((uncorrected / this->max_brightness_.white) * 255UL) / this->local_brightness_;
-    return res;
-  }
+  inline uint8_t color_uncorrect_red(uint8_t red) const ALWAYS_INLINE { return this->uncorrect_(0, red); }
+  inline uint8_t color_uncorrect_green(uint8_t green) const ALWAYS_INLINE { return this->uncorrect_(1, green); }
+  inline uint8_t color_uncorrect_blue(uint8_t blue) const ALWAYS_INLINE { return this->uncorrect_(2, blue); }
+  inline uint8_t color_uncorrect_white(uint8_t white) const ALWAYS_INLINE { return this->uncorrect_(3, white); }
 
  protected:
+  /// Rebuild the tables after gamma or one of the brightness values changed.
+  void update_tables_();
+  inline uint8_t uncorrect_(uint8_t channel, uint8_t value) const ALWAYS_INLINE {
+    const uint32_t res = (this->gamma_reverse_table_[value] * this->uncorrect_scale_[channel]) >> 8;
+    return res > 255 ? 255 : res;
+  }
+
   uint8_t gamma_table_[256];
   uint8_t gamma_reverse_table_[256];
+  /// Gamma, maximum brightness and local brightness combined, one table per distinct maximum brightness.
+  std::unique_ptr<uint8_t[]> tables_;
+  uint8_t table_count_{0};
+  /// The table of each channel (red, green, blue, white) in tables_.
+  const uint8_t *correct_table_[4];
+  /// 255 * 255 / (max_brightness * local_brightness) in 24.8 fixed point per channel, 0 if the channel is off.
+  uint32_t uncorrect_scale_[4];
   Color max_brightness_;
   uint8_t local_brightness_{255};
 };
@@ -5,6 +5,7 @@
 #ifdef USE_JSON
 
 #include "esphome/components/json/json_util.h"
+#include "esphome/components/json/json_writer.h"
 #include "light_call.h"
 #include "light_state.h"
 
@@ -13,7 +14,10 @@ namespace light {
 
 class LightJSONSchema {
  public:
-  /// Dump the state of a light as JSON.
+  /// Dump the state of a light as members of the JSON object the writer is in.
+  static void dump_json(LightState &state, json::JsonWriter &json);
+  ESPDEPRECATED("dump_json() with a JsonObject is deprecated, use the overload with a json::JsonWriter instead.",
+                "2022.9")
   static void dump_json(LightState &state, JsonObject root);
   /// Parse the JSON state of a light to a LightCall.
   static void parse_json(LightState &state, LightCall &call, JsonObject root);
@@ -142,6 +142,10 @@ void LightState::loop() {
     this->next_write_ = false;
     this->output_->write_state(this);
   }
+
+  // Nothing left to animate, wait for the next call, transition or effect
+  if (this->get_active_effect_() == nullptr && this->transformer_ == nullptr && !this->next_write_)
+    this->disable_loop();
 }
 
 float LightState::get_setup_priority() const { return setup_priority::HARDWARE - 1.0f; }
@@ -223,6 +227,7 @@ void LightState::start_effect_(uint32_t effect_index) {
   this->active_effect_index_ = effect_index;
   auto *effect = this->get_active_effect_();
   effect->start_internal();
+  this->enable_loop();
 }
 LightEffect *LightState::get_active_effect_() {
   if (this->active_effect_index_ == 0) {
@@ -242,6 +247,7 @@ void LightState::stop_effect_() {
 void LightState::start_transition_(const LightColorValues &target, uint32_t length, bool set_remote_values) {
   this->transformer_ = this->output_->create_default_transition();
   this->transformer_->setup(this->current_values, target, length);
+  this->enable_loop();
 
   if (set_remote_values) {
     this->remote_values = target;
@@ -257,6 +263,7 @@ void LightState::start_flash_(const LightColorValues &target, uint32_t length, b
 
   this->transformer_ = make_unique<LightFlashTransformer>(*this);
   this->transformer_->setup(end_colors, target, length);
+  this->enable_loop();
 
   if (set_remote_values) {
     this->remote_values = target;
@@ -270,7 +277,7 @@ void LightState::set_immediately_(const LightColorValues &target, bool set_remot
     this->remote_values = target;
   }
   this->output_->update_state(this);
-  this->next_write_ = true;
+  this->schedule_write_();
 }
 
 void LightState::save_remote_values_() {
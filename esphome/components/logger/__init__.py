@@ -7,6 +7,7 @@ from esphome.automation import LambdaAction
 from esphome.const import (
     CONF_ARGS,
     CONF_BAUD_RATE,
+    CONF_BUFFER_SIZE,
     CONF_DEASSERT_RTS_DTR,
     CONF_FORMAT,
     CONF_HARDWARE_UART,
@@ -17,6 +18,8 @@ from esphome.const import (
     CONF_TAG,
     CONF_TRIGGER_ID,
     CONF_TX_BUFFER_SIZE,
+    PLATFORM_ESP32,
+    PLATFORM_HOST,
 )
 from esphome.core import CORE, EsphomeError, Lambda, coroutine_with_priority
 from esphome.components.esp32 import add_idf_sdkconfig_option, get_esp32_variant
@@ -106,6 +109,9 @@ def uart_selection(value):
             return cv.one_of(*UART_SELECTION_ESP32[variant], upper=True)(value)
     if CORE.is_esp8266:
         return cv.one_of(*UART_SELECTION_ESP8266, upper=True)(value)
+    if CORE.is_host:
+        # Logs go to stdout, which takes the place of the first UART
+        return cv.one_of(UART0, upper=True)(value)
     raise NotImplementedError
 
 
@@ -126,6 +132,7 @@ LoggerMessageTrigger = logger_ns.class_(
 )
 
 CONF_ESP8266_STORE_LOG_STRINGS_IN_FLASH = "esp8266_store_log_strings_in_flash"
+CONF_DEFERRED = "deferred"
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
@@ -149,6 +156,16 @@ CONFIG_SCHEMA = cv.All(
             cv.SplitDefault(
                 CONF_ESP8266_STORE_LOG_STRINGS_IN_FLASH, esp8266=True
             ): cv.All(cv.only_on_esp8266, cv.boolean),
+            cv.Optional(CONF_DEFERRED): cv.All(
+                cv.only_on([PLATFORM_ESP32, PLATFORM_HOST]),
+                cv.Schema(
+                    {
+                        cv.Optional(CONF_BUFFER_SIZE, default="4kB"): cv.All(
+                            cv.validate_bytes, cv.int_range(min=1024, max=65536)
+                        ),
+                    }
+                ),
+            ),
         }
     ).extend(cv.COMPONENT_SCHEMA),
     validate_local_no_higher_than_global,
@@ -204,6 +221,9 @@ async def to_code(config):
         cg.add_build_flag("-DENABLE_I2C_DEBUG_BUFFER")
     if config.get(CONF_ESP8266_STORE_LOG_STRINGS_IN_FLASH):
         cg.add_build_flag("-DUSE_STORE_LOG_STR_IN_FLASH")
+    if CONF_DEFERRED in config:
+        cg.add_define("USE_LOGGER_DEFERRED")
+        cg.add(log.set_deferred_buffer_size(config[CONF_DEFERRED][CONF_BUFFER_SIZE]))
 
     if CORE.using_esp_idf:
         if config[CONF_HARDWARE_UART] == USB_CDC:
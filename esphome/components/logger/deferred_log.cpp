@@ -0,0 +1,475 @@
+#include "deferred_log.h"
+
+#ifdef USE_LOGGER_DEFERRED
+
+#include "esphome/core/helpers.h"
+#include <cstdio>
+#include <cstring>
+
+namespace esphome {
+namespace logger {
+
+/// Records start with a word holding size, level and state, the state is published last.
+static const uint32_t STATE_RECORD = 1;
+static const uint32_t STATE_PADDING = 2;
+/// Head word, line and payload size.
+static const uint32_t RECORD_HEADER_SIZE = 8;
+static const size_t MIN_CAPACITY = 1024;
+static const size_t MAX_CAPACITY = 65536;
+/// Longest conversion specification that is formatted, longer ones are printed as they are.
+static const size_t MAX_CONVERSION_LENGTH = 15;
+
+enum class ArgType : uint8_t {
+  /// No argument, like %%.
+  NONE,
+  /// Not a valid conversion, printed verbatim.
+  LITERAL,
+  INT,
+  LONG,
+  LONG_LONG,
+  SIZE,
+  INTMAX,
+  PTRDIFF,
+  DOUBLE,
+  LONG_DOUBLE,
+  STRING,
+  POINTER,
+  /// Pointer that isn't stored or printed (%n, wide strings).
+  IGNORED_POINTER,
+};
+
+struct ConversionSpec {
+  const char *begin;
+  const char *end;
+  bool star_width;
+  bool star_precision;
+  /// Precision given in the format, -1 if there is none.
+  int precision;
+  ArgType type;
+};
+
+static bool is_digit(char c) { return c >= '0' && c <= '9'; }
+
+/// Find the next conversion specification in format, returns false if there is none.
+static bool next_conversion(const char *format, ConversionSpec *spec) {
+  const char *p = strchr(format, '%');
+  if (p == nullptr)
+    return false;
+  spec->begin = p++;
+  spec->star_width = false;
+  spec->star_precision = false;
+  spec->precision = -1;
+  spec->type = ArgType::LITERAL;
+
+  while (*p != '\0' && strchr("-+ #0'", *p) != nullptr)
+    p++;
+  if (*p == '*') {
+    spec->star_width = true;
+    p++;
+  }
+  while (is_digit(*p))
+    p++;
+  if (*p == '.') {
+    p++;
+    if (*p == '*') {
+      spec->star_precision = true;
+      p++;
+    } else {
+      spec->precision = 0;
+      while (is_digit(*p))
+        spec->precision = spec->precision * 10 + (*p++ - '0');
+    }
+  }
+
+  ArgType integer = ArgType::INT;
+  bool long_modifier = false;
+  if (p[0] == 'h') {
+    p += p[1] == 'h' ? 2 : 1;
+  } else if (p[0] == 'l' && p[1] == 'l') {
+    integer = ArgType::LONG_LONG;
+    p += 2;
+  } else if (p[0] == 'l') {
+    integer = ArgType::LONG;
+    long_modifier = true;
+    p++;
+  } else if (p[0] == 'L' || p[0] == 'q') {
+    integer = ArgType::LONG_LONG;
+    long_modifier = true;
+    p++;
+  } else if (p[0] == 'z') {
+    integer = ArgType::SIZE;
+    p++;
+  } else if (p[0] == 'j') {
+    integer = ArgType::INTMAX;
+    p++;
+  } else if (p[0] == 't') {
+    integer = ArgType::PTRDIFF;
+    p++;
+  }
+
+  switch (*p) {
+    case 'd':
+    case 'i':
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X':
+      spec->type = integer;
+      break;
+    case 'c':
+      spec->type = ArgType::INT;
+      break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+      spec->type = long_modifier && p[-1] == 'L' ? ArgType::LONG_DOUBLE : ArgType::DOUBLE;
+      break;
+    case 's':
+      spec->type = long_modifier ? ArgType::IGNORED_POINTER : ArgType::STRING;
+      break;
+    case 'p':
+      spec->type = ArgType::POINTER;
+      break;
+    case 'n':
+      spec->type = ArgType::IGNORED_POINTER;
+      break;
+    case '%':
+      spec->type = ArgType::NONE;
+      break;
+    case '\0':
+      // Format ends inside the specification
+      spec->end = p;
+      return true;
+    default:
+      break;
+  }
+  spec->end = p + 1;
+  return true;
+}
+
+/// Copies arguments into a record, or only measures them if out is null.
+class ArgWriter {
+ public:
+  ArgWriter(uint8_t *out, size_t size) : out_(out), size_(size) {}
+
+  template<typename T> void write(T value) {
+    if (this->out_ != nullptr && this->pos_ + sizeof(T) <= this->size_)
+      memcpy(this->out_ + this->pos_, &value, sizeof(T));
+    this->pos_ += sizeof(T);
+  }
+  void write_string(const char *value, size_t max_length) {
+    if (value == nullptr)
+      value = "(null)";
+    size_t length = strnlen(value, max_length);
+    if (this->out_ != nullptr) {
+      // The string may have grown since it was measured, never write past the record
+      if (this->pos_ >= this->size_)
+        return;
+      if (this->pos_ + length + 1 > this->size_)
+        length = this->size_ - this->pos_ - 1;
+      memcpy(this->out_ + this->pos_, value, length);
+      this->out_[this->pos_ + length] = '\0';
+    }
+    this->pos_ += length + 1;
+  }
+  size_t get_size() const { return this->pos_; }
+
+ protected:
+  uint8_t *out_;
+  size_t size_;
+  size_t pos_{0};
+};
+
+static size_t capture_args(const char *format, va_list args, ArgWriter *writer, size_t max_string_length) {  // NOLINT
+  ConversionSpec spec;
+  for (const char *p = format; next_conversion(p, &spec); p = spec.end) {
+    int precision = spec.precision;
+    if (spec.star_width)
+      writer->write(va_arg(args, int));
+    if (spec.star_precision) {
+      precision = va_arg(args, int);
+      writer->write(precision);
+    }
+    switch (spec.type) {
+      case ArgType::NONE:
+      case ArgType::LITERAL:
+        break;
+      case ArgType::INT:
+        writer->write(va_arg(args, int));
+        break;
+      case ArgType::LONG:
+        writer->write(va_arg(args, long));
+        break;
+      case ArgType::LONG_LONG:
+        writer->write(va_arg(args, long long));
+        break;
+      case ArgType::SIZE:
+        writer->write(va_arg(args, size_t));
+        break;
+      case ArgType::INTMAX:
+        writer->write(va_arg(args, intmax_t));
+        break;
+      case ArgType::PTRDIFF:
+        writer->write(va_arg(args, ptrdiff_t));
+        break;
+      case ArgType::DOUBLE:
+        writer->write(va_arg(args, double));
+        break;
+      case ArgType::LONG_DOUBLE:
+        writer->write(va_arg(args, long double));
+        break;
+      case ArgType::STRING: {
+        const char *value = va_arg(args, const char *);
+        const size_t limit = precision >= 0 && size_t(precision) < max_string_length ? precision : max_string_length;
+        writer->write_string(value, limit);
+        break;
+      }
+      case ArgType::POINTER:
+        writer->write(va_arg(args, const void *));
+        break;
+      case ArgType::IGNORED_POINTER:
+        va_arg(args, void *);
+        break;
+    }
+  }
+  return writer->get_size();
+}
+
+/// Reads arguments back from a record.
+class ArgReader {
+ public:
+  ArgReader(const uint8_t *args, const uint8_t *end) : args_(args), end_(end) {}
+
+  template<typename T> T read() {
+    T value{};
+    if (this->args_ + sizeof(T) <= this->end_)
+      memcpy(&value, this->args_, sizeof(T));
+    this->args_ += sizeof(T);
+    return value;
+  }
+  const char *read_string() {
+    if (this->args_ >= this->end_)
+      return "";
+    const char *value = reinterpret_cast<const char *>(this->args_);
+    this->args_ += strnlen(value, this->end_ - this->args_) + 1;
+    return value;
+  }
+
+ protected:
+  const uint8_t *args_;
+  const uint8_t *end_;
+};
+
+template<typename T>
+static int format_arg(char *buffer, size_t size, const char *conversion, const int *stars, uint8_t star_count,
+                      T value) {
+  switch (star_count) {
+    case 0:
+      return snprintf(buffer, size, conversion, value);
+    case 1:
+      return snprintf(buffer, size, conversion, stars[0], value);
+    default:
+      return snprintf(buffer, size, conversion, stars[0], stars[1], value);
+  }
+}
+
+void DeferredLogBuffer::init(size_t size, size_t max_string_length) {
+  size_t capacity = MIN_CAPACITY;
+  while (capacity < size && capacity < MAX_CAPACITY)
+    capacity <<= 1;
+  this->data_.reset(new uint32_t[capacity / 4]());  // NOLINT(cppcoreguidelines-owning-memory)
+  this->capacity_ = capacity;
+  this->mask_ = capacity - 1;
+  this->max_string_length_ = max_string_length;
+  this->reserve_.store(0);
+  this->read_.store(0);
+}
+
+bool HOT DeferredLogBuffer::push(int level, const char *tag, int line, const char *format,  // NOLINT
+                                 va_list args) {
+  va_list measure;
+  va_copy(measure, args);
+  ArgWriter sizer(nullptr, 0);
+  const size_t args_size = capture_args(format, measure, &sizer, this->max_string_length_);
+  va_end(measure);
+
+  const size_t tag_size = strlen(tag) + 1;
+  const size_t format_size = strlen(format) + 1;
+  const size_t payload = RECORD_HEADER_SIZE + tag_size + format_size + args_size;
+  const uint32_t size = (payload + 3) & ~uint32_t(3);
+  // A quarter of the buffer keeps one long message from starving all others
+  if (this->capacity_ == 0 || size > this->capacity_ / 4 || size > 0xFFFC) {
+    this->dropped_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  uint32_t position = this->reserve_.load(std::memory_order_relaxed);
+  uint32_t start, needed;
+  do {
+    // Records are contiguous, skip the end of the buffer if the record doesn't fit before it
+    const uint32_t tail = this->capacity_ - (position & this->mask_);
+    start = tail < size ? position + tail : position;
+    needed = start - position + size;
+    if (position - this->read_.load(std::memory_order_acquire) + needed > this->capacity_) {
+      this->dropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+  } while (!this->reserve_.compare_exchange_weak(position, position + needed, std::memory_order_acq_rel,
+                                                 std::memory_order_relaxed));
+
+  if (start != position) {
+    auto *padding = reinterpret_cast<uint32_t *>(this->at_(position));
+    __atomic_store_n(padding, (start - position) | (STATE_PADDING << 24), __ATOMIC_RELEASE);
+  }
+
+  uint8_t *record = this->at_(start);
+  const uint16_t line16 = line;
+  const uint16_t payload16 = payload;
+  memcpy(record + 4, &line16, sizeof(line16));
+  memcpy(record + 6, &payload16, sizeof(payload16));
+  memcpy(record + RECORD_HEADER_SIZE, tag, tag_size);
+  memcpy(record + RECORD_HEADER_SIZE + tag_size, format, format_size);
+  va_list copy;
+  va_copy(copy, args);
+  ArgWriter writer(record + RECORD_HEADER_SIZE + tag_size + format_size, args_size);
+  capture_args(format, copy, &writer, this->max_string_length_);
+  va_end(copy);
+
+  const uint32_t head = size | (uint32_t(level & 0xFF) << 16) | (STATE_RECORD << 24);
+  __atomic_store_n(reinterpret_cast<uint32_t *>(record), head, __ATOMIC_RELEASE);
+  return true;
+}
+
+bool DeferredLogBuffer::peek(uint32_t end, DeferredLogRecord *record) {
+  while (true) {
+    // Only the consumer moves the read position
+    const uint32_t position = this->read_.load(std::memory_order_relaxed);
+    if (position == end)
+      return false;
+    const uint8_t *data = this->at_(position);
+    const uint32_t head = __atomic_load_n(reinterpret_cast<const uint32_t *>(data), __ATOMIC_ACQUIRE);
+    const uint32_t state = head >> 24;
+    const uint32_t size = head & 0xFFFF;
+    if (state == STATE_PADDING) {
+      this->release_(position, size);
+      continue;
+    }
+    if (state != STATE_RECORD)
+      return false;
+
+    uint16_t line, payload;
+    memcpy(&line, data + 4, sizeof(line));
+    memcpy(&payload, data + 6, sizeof(payload));
+    record->level = (head >> 16) & 0xFF;
+    record->line = line;
+    record->tag = reinterpret_cast<const char *>(data + RECORD_HEADER_SIZE);
+    record->format = record->tag + strlen(record->tag) + 1;
+    record->args = reinterpret_cast<const uint8_t *>(record->format + strlen(record->format) + 1);
+    record->args_end = data + payload;
+    record->position = position;
+    record->size = size;
+    return true;
+  }
+}
+
+void DeferredLogBuffer::release_(uint32_t position, uint32_t size) {
+  // Free space must read as zero, so a record's state isn't taken from old contents before it is published
+  memset(this->at_(position), 0, size);
+  this->read_.store(position + size, std::memory_order_release);
+}
+
+size_t DeferredLogBuffer::format(const DeferredLogRecord &record, char *buffer, size_t size) {
+  if (size == 0)
+    return 0;
+  ArgReader reader(record.args, record.args_end);
+  size_t at = 0;
+  const char *text = record.format;
+  ConversionSpec spec;
+  while (at + 1 < size) {
+    const bool found = next_conversion(text, &spec);
+    const char *literal_end = found ? spec.begin : text + strlen(text);
+    size_t length = literal_end - text;
+    if (length > size - 1 - at)
+      length = size - 1 - at;
+    memcpy(buffer + at, text, length);
+    at += length;
+    if (!found)
+      break;
+    text = spec.end;
+
+    int stars[2];
+    uint8_t star_count = 0;
+    if (spec.star_width)
+      stars[star_count++] = reader.read<int>();
+    if (spec.star_precision)
+      stars[star_count++] = reader.read<int>();
+
+    char conversion[MAX_CONVERSION_LENGTH + 1];
+    const size_t conversion_length = spec.end - spec.begin;
+    if (conversion_length > MAX_CONVERSION_LENGTH)
+      spec.type = ArgType::LITERAL;
+    else
+      memcpy(conversion, spec.begin, conversion_length);
+    conversion[conversion_length > MAX_CONVERSION_LENGTH ? 0 : conversion_length] = '\0';
+
+    char *out = buffer + at;
+    const size_t remaining = size - at;
+    int ret = 0;
+    switch (spec.type) {
+      case ArgType::NONE:
+        ret = snprintf(out, remaining, "%%");
+        break;
+      case ArgType::LITERAL:
+        ret = conversion_length < remaining ? conversion_length : remaining - 1;
+        memcpy(out, spec.begin, ret);
+        break;
+      case ArgType::INT:
+        ret = format_arg(out, remaining, conversion, stars, star_count, reader.read<int>());
+        break;
+      case ArgType::LONG:
+        ret = format_arg(out, remaining, conversion, stars, star_count, reader.read<long>());
+        break;
+      case ArgType::LONG_LONG:
+        ret = format_arg(out, remaining, conversion, stars, star_count, reader.read<long long>());
+        break;
+      case ArgType::SIZE:
+        ret = format_arg(out, remaining, conversion, stars, star_count, reader.read<size_t>());
+        break;
+      case ArgType::INTMAX:
+        ret = format_arg(out, remaining, conversion, stars, star_count, reader.read<intmax_t>());
+        break;
+      case ArgType::PTRDIFF:
+        ret = format_arg(out, remaining, conversion, stars, star_count, reader.read<ptrdiff_t>());
+        break;
+      case ArgType::DOUBLE:
+        ret = format_arg(out, remaining, conversion, stars, star_count, reader.read<double>());
+        break;
+      case ArgType::LONG_DOUBLE:
+        ret = format_arg(out, remaining, conversion, stars, star_count, reader.read<long double>());
+        break;
+      case ArgType::STRING:
+        ret = format_arg(out, remaining, conversion, stars, star_count, reader.read_string());
+        break;
+      case ArgType::POINTER:
+        ret = format_arg(out, remaining, conversion, stars, star_count, reader.read<const void *>());
+        break;
+      case ArgType::IGNORED_POINTER:
+        break;
+    }
+    if (ret < 0)
+      ret = 0;
+    at += size_t(ret) < remaining ? ret : remaining - 1;
+  }
+  buffer[at] = '\0';
+  return at;
+}
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_LOGGER_DEFERRED
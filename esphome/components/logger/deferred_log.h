@@ -0,0 +1,77 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_LOGGER_DEFERRED
+
+#include <atomic>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace esphome {
+namespace logger {
+
+/// A captured log call, pointing into the buffer until it is released.
+struct DeferredLogRecord {
+  int level;
+  int line;
+  const char *tag;
+  const char *format;
+  /// Arguments in the order the format consumes them, strings are stored inline.
+  const uint8_t *args;
+  const uint8_t *args_end;
+  uint32_t position;
+  uint32_t size;
+};
+
+/** Lock-free buffer of log calls that are formatted later.
+ *
+ * push() may be called from any task: it only copies the tag, the format string and the raw arguments (after
+ * default promotions, strings copied up to their precision) into a record, no formatting or I/O happens on the
+ * caller. Space is reserved with a compare-and-swap on the write position and every record carries a state that
+ * is published last, so producers never wait on each other and the consumer stops at the first record that is
+ * still being written. A single consumer (the logger loop) reads records in order with peek(), formats them with
+ * format() and hands the space back with release(). When the buffer is full the call is counted and dropped.
+ */
+class DeferredLogBuffer {
+ public:
+  /// Allocate the buffer, size is rounded up to a power of two.
+  void init(size_t size, size_t max_string_length);
+
+  /// Capture a log call, returns false (and counts it as dropped) if it doesn't fit.
+  bool push(int level, const char *tag, int line, const char *format, va_list args);  // NOLINT
+
+  /// Position after the last reserved record, records after it are left for the next round.
+  uint32_t get_end() const { return this->reserve_.load(std::memory_order_acquire); }
+  /// Get the oldest record before end, false if there is none or it isn't complete yet.
+  bool peek(uint32_t end, DeferredLogRecord *record);
+  /// Free the space of a record returned by peek().
+  void release(const DeferredLogRecord &record) { this->release_(record.position, record.size); }
+
+  /// Format a record like vsnprintf(), returns the number of characters written (excluding the null terminator).
+  static size_t format(const DeferredLogRecord &record, char *buffer, size_t size);
+
+  size_t get_capacity() const { return this->capacity_; }
+  uint32_t get_dropped() const { return this->dropped_.load(std::memory_order_relaxed); }
+
+ protected:
+  uint8_t *at_(uint32_t position) { return reinterpret_cast<uint8_t *>(this->data_.get()) + (position & this->mask_); }
+  void release_(uint32_t position, uint32_t size);
+
+  std::unique_ptr<uint32_t[]> data_;
+  size_t capacity_{0};
+  uint32_t mask_{0};
+  size_t max_string_length_{0};
+  /// Written by producers.
+  std::atomic<uint32_t> reserve_{0};
+  /// Written by the consumer.
+  std::atomic<uint32_t> read_{0};
+  std::atomic<uint32_t> dropped_{0};
+};
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_LOGGER_DEFERRED
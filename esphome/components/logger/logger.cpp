@@ -5,6 +5,11 @@
 #include <driver/uart.h>
 #endif
 
+#if defined(USE_LOGGER_DEFERRED) && defined(USE_ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
 #if defined(USE_ESP32_FRAMEWORK_ARDUINO) || defined(USE_ESP_IDF)
 #include <esp_log.h>
 #endif
@@ -15,6 +20,10 @@ namespace esphome {
 namespace logger {
 
 static const char *const TAG = "logger";
+#ifdef USE_LOGGER_DEFERRED
+/// Shortest time between two warnings about dropped messages.
+static const uint32_t DEFERRED_REPORT_INTERVAL = 10000;
+#endif
 
 static const char *const LOG_LEVEL_COLORS[] = {
     "",                                            // NONE
@@ -49,6 +58,20 @@ void Logger::write_header_(int level, const char *tag, int line) {
 }
 
 void HOT Logger::log_vprintf_(int level, const char *tag, int line, const char *format, va_list args) {  // NOLINT
+#ifdef USE_LOGGER_DEFERRED
+  if (this->deferred_started_.load(std::memory_order_relaxed)) {
+    if (level > this->level_for(tag))
+      return;
+    if (this->is_loop_task_() && this->recursion_guard_) {
+      // Logged by a log callback while loop() writes records, queueing it would refill the buffer every loop
+      this->deferred_recursive_dropped_++;
+      return;
+    }
+    // Safe from any task, formatting and output happen in loop()
+    this->deferred_.push(level, tag, line, format, args);
+    return;
+  }
+#endif
   if (level > this->level_for(tag) || recursion_guard_)
     return;
 
@@ -132,6 +155,9 @@ void HOT Logger::log_message_(int level, const char *tag, int offset) {
       uart_write_bytes(uart_num_, msg, strlen(msg));
       uart_write_bytes(uart_num_, "\n", 1);
     }
+#endif
+#ifdef USE_HOST
+    puts(msg);
 #endif
   }
 
@@ -231,6 +257,10 @@ void Logger::pre_setup() {
     uart_set_debug(UART_NO);
   }
 #endif  // USE_ESP8266
+#ifdef USE_HOST
+  // stdout is fully buffered when it isn't a terminal, flush every line like a UART would
+  setvbuf(stdout, nullptr, _IOLBF, 0);
+#endif  // USE_HOST
 
   global_logger = this;
 #if defined(USE_ESP_IDF) || defined(USE_ESP32_FRAMEWORK_ARDUINO)
@@ -242,6 +272,63 @@ void Logger::pre_setup() {
 
   ESP_LOGI(TAG, "Log initialized");
 }
+#ifdef USE_LOGGER_DEFERRED
+void Logger::set_deferred_buffer_size(size_t size) { this->deferred_.init(size, this->tx_buffer_size_); }
+void Logger::loop() {
+  if (!this->deferred_started_.load(std::memory_order_relaxed)) {
+#ifdef USE_ESP32
+    this->loop_task_ = xTaskGetCurrentTaskHandle();
+#endif
+    this->deferred_started_.store(true, std::memory_order_relaxed);
+  }
+
+  // Only the records queued so far, other tasks may keep adding records while these are written
+  const uint32_t end = this->deferred_.get_end();
+  DeferredLogRecord record;
+  while (this->deferred_.peek(end, &record)) {
+    this->write_deferred_(record);
+    this->deferred_.release(record);
+  }
+
+  // The warnings go through the log callbacks as well, so they are rate limited or a callback that logs on every
+  // message would cause one every loop
+  const uint32_t now = millis();
+  if (now - this->deferred_last_report_ < DEFERRED_REPORT_INTERVAL)
+    return;
+  const uint32_t dropped = this->deferred_.get_dropped();
+  if (dropped != this->deferred_dropped_reported_) {
+    ESP_LOGW(TAG, "%u log messages dropped, the deferred buffer is too small",
+             (unsigned) (dropped - this->deferred_dropped_reported_));
+    this->deferred_dropped_reported_ = dropped;
+    this->deferred_last_report_ = now;
+  }
+  if (this->deferred_recursive_dropped_ != 0) {
+    ESP_LOGW(TAG, "%u log messages from log callbacks dropped", (unsigned) this->deferred_recursive_dropped_);
+    this->deferred_recursive_dropped_ = 0;
+    this->deferred_last_report_ = now;
+  }
+}
+bool Logger::is_loop_task_() const {
+#ifdef USE_ESP32
+  return xTaskGetCurrentTaskHandle() == this->loop_task_;
+#else
+  // Only the ESP32 logs from other tasks
+  return true;
+#endif
+}
+void Logger::write_deferred_(const DeferredLogRecord &record) {
+  this->recursion_guard_ = true;
+  this->reset_buffer_();
+  this->write_header_(record.level, record.tag, record.line);
+  if (!this->is_buffer_full_()) {
+    this->tx_buffer_at_ +=
+        DeferredLogBuffer::format(record, this->tx_buffer_ + this->tx_buffer_at_, this->buffer_remaining_capacity_());
+  }
+  this->write_footer_();
+  this->log_message_(record.level, record.tag);
+  this->recursion_guard_ = false;
+}
+#endif
 void Logger::set_baud_rate(uint32_t baud_rate) { this->baud_rate_ = baud_rate; }
 void Logger::set_log_level(const std::string &tag, int log_level) {
   this->log_levels_.push_back(LogLevelOverride{tag, log_level});
@@ -271,6 +358,9 @@ const char *const UART_SELECTIONS[] = {
 #ifdef USE_ESP8266
 const char *const UART_SELECTIONS[] = {"UART0", "UART1", "UART0_SWAP"};
 #endif  // USE_ESP8266
+#ifdef USE_HOST
+const char *const UART_SELECTIONS[] = {"STDOUT"};
+#endif  // USE_HOST
 void Logger::dump_config() {
   ESP_LOGCONFIG(TAG, "Logger:");
   ESP_LOGCONFIG(TAG, "  Level: %s", LOG_LEVELS[ESPHOME_LOG_LEVEL]);
@@ -279,6 +369,10 @@ void Logger::dump_config() {
   for (auto &it : this->log_levels_) {
     ESP_LOGCONFIG(TAG, "  Level for '%s': %s", it.tag.c_str(), LOG_LEVELS[it.level]);
   }
+#ifdef USE_LOGGER_DEFERRED
+  ESP_LOGCONFIG(TAG, "  Deferred Buffer Size: %zu bytes", this->deferred_.get_capacity());
+  ESP_LOGCONFIG(TAG, "  Deferred Messages Dropped: %u", (unsigned) this->deferred_.get_dropped());
+#endif
 }
 void Logger::write_footer_() { this->write_to_buffer_(ESPHOME_LOG_RESET_COLOR, strlen(ESPHOME_LOG_RESET_COLOR)); }
 
@@ -6,6 +6,10 @@
 #include "esphome/core/defines.h"
 #include <cstdarg>
 
+#ifdef USE_LOGGER_DEFERRED
+#include "deferred_log.h"
+#endif
+
 #ifdef USE_ARDUINO
 #include <HardwareSerial.h>
 #endif
@@ -62,11 +66,24 @@ class Logger : public Component {
   /// Set the log level of the specified tag.
   void set_log_level(const std::string &tag, int log_level);
 
+#ifdef USE_LOGGER_DEFERRED
+  /** Capture log calls into a buffer of the given size and format and write them from loop().
+   *
+   * Messages logged before the first loop() are still written immediately.
+   */
+  void set_deferred_buffer_size(size_t size);
+  /// Number of messages dropped because the deferred buffer was full.
+  uint32_t get_deferred_dropped() const { return this->deferred_.get_dropped(); }
+#endif
+
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Set up this component.
   void pre_setup();
   void dump_config() override;
+#ifdef USE_LOGGER_DEFERRED
+  void loop() override;
+#endif
 
   int level_for(const char *tag);
 
@@ -84,6 +101,11 @@ class Logger : public Component {
   void write_header_(int level, const char *tag, int line);
   void write_footer_();
   void log_message_(int level, const char *tag, int offset = 0);
+#ifdef USE_LOGGER_DEFERRED
+  void write_deferred_(const DeferredLogRecord &record);
+  /// Whether the caller runs on the task that calls loop().
+  bool is_loop_task_() const;
+#endif
 
   inline bool is_buffer_full_() const { return this->tx_buffer_at_ >= this->tx_buffer_size_; }
   inline int buffer_remaining_capacity_() const { return this->tx_buffer_size_ - this->tx_buffer_at_; }
@@ -142,6 +164,18 @@ class Logger : public Component {
   CallbackManager<void(int, const char *, const char *)> log_callback_{};
   /// Prevents recursive log calls, if true a log message is already being processed.
   bool recursion_guard_ = false;
+#ifdef USE_LOGGER_DEFERRED
+  DeferredLogBuffer deferred_;
+  /// Set by the first loop(), from then on log calls only go into deferred_.
+  std::atomic<bool> deferred_started_{false};
+  uint32_t deferred_dropped_reported_{0};
+  /// Messages logged by log callbacks while loop() wrote records, only touched by the loop task.
+  uint32_t deferred_recursive_dropped_{0};
+  uint32_t deferred_last_report_{0};
+#ifdef USE_ESP32
+  void *loop_task_{nullptr};
+#endif
+#endif
 };
 
 extern Logger *global_logger;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
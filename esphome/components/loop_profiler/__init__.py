@@ -0,0 +1,27 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.const import CONF_ID
+
+DEPENDENCIES = ["logger"]
+
+CONF_LOOP_PROFILER_ID = "loop_profiler_id"
+CONF_REPORT_COUNT = "report_count"
+
+loop_profiler_ns = cg.esphome_ns.namespace("loop_profiler")
+LoopProfilerComponent = loop_profiler_ns.class_(
+    "LoopProfilerComponent", cg.PollingComponent
+)
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(LoopProfilerComponent),
+        cv.Optional(CONF_REPORT_COUNT, default=10): cv.int_range(min=0, max=255),
+    }
+).extend(cv.polling_component_schema("60s"))
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    cg.add(var.set_report_count(config[CONF_REPORT_COUNT]))
+    cg.add_define("USE_LOOP_PROFILER")
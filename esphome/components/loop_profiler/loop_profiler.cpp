@@ -0,0 +1,135 @@
+#include "loop_profiler.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+
+namespace esphome {
+namespace loop_profiler {
+
+static const char *const TAG = "loop_profiler";
+
+static float get_statistic(const RuntimeStats &stats, ProfilerStatistic statistic, uint32_t window_ms) {
+  switch (statistic) {
+    case PROFILER_STATISTIC_AVERAGE:
+      return stats.average();
+    case PROFILER_STATISTIC_MAX:
+      return stats.max_us;
+    case PROFILER_STATISTIC_P50:
+      return stats.percentile(0.50f);
+    case PROFILER_STATISTIC_P95:
+      return stats.percentile(0.95f);
+    case PROFILER_STATISTIC_P99:
+      return stats.percentile(0.99f);
+    case PROFILER_STATISTIC_LOAD:
+      return window_ms == 0 ? NAN : stats.sum_us / (window_ms * 10.0f);
+    default:
+      return NAN;
+  }
+}
+
+void LoopProfilerComponent::dump_config() {
+  ESP_LOGCONFIG(TAG, "Loop Profiler:");
+  ESP_LOGCONFIG(TAG, "  Report Count: %u", this->report_count_);
+  LOG_UPDATE_INTERVAL(this);
+#ifdef USE_SENSOR
+  for (auto *sensor : this->sensors_)
+    LOG_SENSOR("  ", "Sensor", sensor);
+#endif
+}
+
+float LoopProfilerComponent::get_setup_priority() const { return setup_priority::LATE; }
+
+void LoopProfilerComponent::update() {
+  auto &profiler = App.profiler;
+  const uint32_t now = millis();
+  const uint32_t window_ms = now - profiler.get_window_start();
+
+#ifdef USE_SENSOR
+  for (auto *sensor : this->sensors_) {
+    const RuntimeStats *stats = nullptr;
+    switch (sensor->get_source()) {
+      case PROFILER_SOURCE_LOOP:
+      case PROFILER_SOURCE_SCHEDULER: {
+        auto *profile = profiler.get_component_profile(sensor->get_component());
+        if (profile != nullptr)
+          stats = sensor->get_source() == PROFILER_SOURCE_LOOP ? &profile->loop : &profile->scheduler;
+        break;
+      }
+      case PROFILER_SOURCE_ITERATION:
+        stats = &profiler.get_iteration_stats();
+        break;
+      case PROFILER_SOURCE_JITTER:
+        stats = &profiler.get_jitter_stats();
+        break;
+    }
+    sensor->publish_state(stats == nullptr ? NAN : get_statistic(*stats, sensor->get_statistic(), window_ms));
+  }
+#endif
+
+  this->log_report_(window_ms);
+  profiler.reset_window(now);
+}
+
+void LoopProfilerComponent::log_report_(uint32_t window_ms) {
+  // Sorting the profiles is only needed for the report itself
+#ifdef ESPHOME_LOG_HAS_DEBUG
+  auto &profiler = App.profiler;
+  const auto &iteration = profiler.get_iteration_stats();
+  const auto &jitter = profiler.get_jitter_stats();
+  ESP_LOGD(TAG, "Main loop over %.1fs: %u iterations, avg %.0fus, max %uus, p99 %uus, load %.1f%%", window_ms / 1e3f,
+           iteration.count, iteration.average(), iteration.max_us, iteration.percentile(0.99f),
+           get_statistic(iteration, PROFILER_STATISTIC_LOAD, window_ms));
+  ESP_LOGD(TAG, "Main loop jitter: avg %.0fus, max %uus, p99 %uus", jitter.average(), jitter.max_us,
+           jitter.percentile(0.99f));
+
+  if (this->report_count_ == 0)
+    return;
+
+  auto &components = profiler.get_component_profiles();
+  if (this->sorted_components_.size() != components.size()) {
+    this->sorted_components_.clear();
+    for (auto &profile : components)
+      this->sorted_components_.push_back(&profile);
+  }
+  const size_t component_count = std::min<size_t>(this->report_count_, this->sorted_components_.size());
+  std::partial_sort(this->sorted_components_.begin(), this->sorted_components_.begin() + component_count,
+                    this->sorted_components_.end(), [](const ComponentProfile *a, const ComponentProfile *b) {
+                      return a->loop.sum_us + a->scheduler.sum_us > b->loop.sum_us + b->scheduler.sum_us;
+                    });
+  ESP_LOGD(TAG, "Slowest components:");
+  for (size_t i = 0; i < component_count; i++) {
+    const auto *profile = this->sorted_components_[i];
+    if (profile->loop.count == 0 && profile->scheduler.count == 0)
+      break;
+    ESP_LOGD(TAG, "  %s: loop %u calls avg %.0fus max %uus p95 %uus, scheduler %u calls avg %.0fus max %uus",
+             profile->component->get_component_source(), profile->loop.count, profile->loop.average(),
+             profile->loop.max_us, profile->loop.percentile(0.95f), profile->scheduler.count,
+             profile->scheduler.average(), profile->scheduler.max_us);
+  }
+
+  auto &items = profiler.get_scheduler_item_profiles();
+  if (this->sorted_items_.size() != items.size()) {
+    this->sorted_items_.clear();
+    for (auto &item : items)
+      this->sorted_items_.push_back(&item);
+  }
+  const size_t item_count = std::min<size_t>(this->report_count_, this->sorted_items_.size());
+  std::partial_sort(this->sorted_items_.begin(), this->sorted_items_.begin() + item_count, this->sorted_items_.end(),
+                    [](const SchedulerItemProfile *a, const SchedulerItemProfile *b) {
+                      return a->stats.sum_us > b->stats.sum_us;
+                    });
+  ESP_LOGD(TAG, "Slowest scheduler items:");
+  for (size_t i = 0; i < item_count; i++) {
+    const auto *item = this->sorted_items_[i];
+    if (item->stats.count == 0)
+      break;
+    ESP_LOGD(TAG, "  %s '%s': %u calls avg %.0fus max %uus", item->component->get_component_source(),
+             item->name.c_str(), item->stats.count, item->stats.average(), item->stats.max_us);
+  }
+#endif
+}
+
+}  // namespace loop_profiler
+}  // namespace esphome
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+#include "esphome/core/profiler.h"
+
+#include <vector>
+
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+
+namespace esphome {
+namespace loop_profiler {
+
+enum ProfilerSource {
+  PROFILER_SOURCE_LOOP,       ///< loop() of one component
+  PROFILER_SOURCE_SCHEDULER,  ///< Timeouts and intervals of one component
+  PROFILER_SOURCE_ITERATION,  ///< Active time of a whole main loop iteration
+  PROFILER_SOURCE_JITTER,     ///< Lateness of main loop iterations
+};
+
+enum ProfilerStatistic {
+  PROFILER_STATISTIC_AVERAGE,
+  PROFILER_STATISTIC_MAX,
+  PROFILER_STATISTIC_P50,
+  PROFILER_STATISTIC_P95,
+  PROFILER_STATISTIC_P99,
+  PROFILER_STATISTIC_LOAD,  ///< Share of the report window in percent
+};
+
+#ifdef USE_SENSOR
+class LoopProfilerSensor : public sensor::Sensor {
+ public:
+  void set_component(Component *component) { this->component_ = component; }
+  void set_source(ProfilerSource source) { this->source_ = source; }
+  void set_statistic(ProfilerStatistic statistic) { this->statistic_ = statistic; }
+
+  Component *get_component() const { return this->component_; }
+  ProfilerSource get_source() const { return this->source_; }
+  ProfilerStatistic get_statistic() const { return this->statistic_; }
+
+ protected:
+  Component *component_{nullptr};
+  ProfilerSource source_{PROFILER_SOURCE_ITERATION};
+  ProfilerStatistic statistic_{PROFILER_STATISTIC_MAX};
+};
+#endif  // USE_SENSOR
+
+/** Reports the statistics collected by the core LoopProfiler.
+ *
+ * Every update the slowest components and scheduler items of the past window are logged (and thereby
+ * streamed to API and MQTT log subscribers), all sensors are published and a new window is started.
+ */
+class LoopProfilerComponent : public PollingComponent {
+ public:
+  void update() override;
+  void dump_config() override;
+  float get_setup_priority() const override;
+
+  void set_report_count(uint8_t report_count) { this->report_count_ = report_count; }
+#ifdef USE_SENSOR
+  void register_sensor(LoopProfilerSensor *sensor) { this->sensors_.push_back(sensor); }
+#endif
+
+ protected:
+  void log_report_(uint32_t window_ms);
+
+  uint8_t report_count_{10};
+  std::vector<ComponentProfile *> sorted_components_;
+  std::vector<SchedulerItemProfile *> sorted_items_;
+#ifdef USE_SENSOR
+  std::vector<LoopProfilerSensor *> sensors_;
+#endif
+};
+
+}  // namespace loop_profiler
+}  // namespace esphome
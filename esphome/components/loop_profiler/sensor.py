@@ -0,0 +1,87 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import sensor
+from esphome.const import (
+    CONF_COMPONENT_ID,
+    CONF_SOURCE,
+    CONF_TYPE,
+    CONF_UNIT_OF_MEASUREMENT,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    ICON_TIMER,
+    STATE_CLASS_MEASUREMENT,
+    UNIT_PERCENT,
+)
+from . import CONF_LOOP_PROFILER_ID, LoopProfilerComponent, loop_profiler_ns
+
+DEPENDENCIES = ["loop_profiler"]
+
+UNIT_MICROSECOND = "µs"
+
+LoopProfilerSensor = loop_profiler_ns.class_("LoopProfilerSensor", sensor.Sensor)
+
+ProfilerSource = loop_profiler_ns.enum("ProfilerSource")
+SOURCES = {
+    "loop": ProfilerSource.PROFILER_SOURCE_LOOP,
+    "scheduler": ProfilerSource.PROFILER_SOURCE_SCHEDULER,
+    "iteration": ProfilerSource.PROFILER_SOURCE_ITERATION,
+    "jitter": ProfilerSource.PROFILER_SOURCE_JITTER,
+}
+COMPONENT_SOURCES = ["loop", "scheduler"]
+
+ProfilerStatistic = loop_profiler_ns.enum("ProfilerStatistic")
+STATISTICS = {
+    "average": ProfilerStatistic.PROFILER_STATISTIC_AVERAGE,
+    "max": ProfilerStatistic.PROFILER_STATISTIC_MAX,
+    "p50": ProfilerStatistic.PROFILER_STATISTIC_P50,
+    "p95": ProfilerStatistic.PROFILER_STATISTIC_P95,
+    "p99": ProfilerStatistic.PROFILER_STATISTIC_P99,
+    "load": ProfilerStatistic.PROFILER_STATISTIC_LOAD,
+}
+
+
+def validate_source(config):
+    source = config.get(CONF_SOURCE)
+    if source is None:
+        source = "loop" if CONF_COMPONENT_ID in config else "iteration"
+        config[CONF_SOURCE] = source
+    if (source in COMPONENT_SOURCES) != (CONF_COMPONENT_ID in config):
+        if source in COMPONENT_SOURCES:
+            raise cv.Invalid(f"Source '{source}' requires a '{CONF_COMPONENT_ID}'")
+        raise cv.Invalid(
+            f"Source '{source}' measures the whole main loop and cannot be combined with '{CONF_COMPONENT_ID}'"
+        )
+    if CONF_UNIT_OF_MEASUREMENT not in config:
+        config[CONF_UNIT_OF_MEASUREMENT] = (
+            UNIT_PERCENT if config[CONF_TYPE] == "load" else UNIT_MICROSECOND
+        )
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
+    sensor.sensor_schema(
+        LoopProfilerSensor,
+        icon=ICON_TIMER,
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_MEASUREMENT,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ).extend(
+        {
+            cv.GenerateID(CONF_LOOP_PROFILER_ID): cv.use_id(LoopProfilerComponent),
+            cv.Optional(CONF_COMPONENT_ID): cv.use_id(cg.Component),
+            cv.Optional(CONF_SOURCE): cv.enum(SOURCES, lower=True),
+            cv.Optional(CONF_TYPE, default="max"): cv.enum(STATISTICS, lower=True),
+        }
+    ),
+    validate_source,
+)
+
+
+async def to_code(config):
+    parent = await cg.get_variable(config[CONF_LOOP_PROFILER_ID])
+    var = await sensor.new_sensor(config)
+    cg.add(var.set_source(SOURCES[config[CONF_SOURCE]]))
+    cg.add(var.set_statistic(STATISTICS[config[CONF_TYPE]]))
+    if CONF_COMPONENT_ID in config:
+        component = await cg.get_variable(config[CONF_COMPONENT_ID])
+        cg.add(var.set_component(component))
+    cg.add(parent.register_sensor(var))
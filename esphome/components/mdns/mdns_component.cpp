@@ -38,6 +38,9 @@ void MDNSComponent::compile_records_() {
 #endif
 #ifdef USE_ESP32
     platform = "ESP32";
+#endif
+#ifdef USE_HOST
+    platform = "Host";
 #endif
     if (platform != nullptr) {
       service.txt_records.push_back({"platform", platform});
@@ -0,0 +1,20 @@
+#ifdef USE_HOST
+
+#include "mdns_component.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace mdns {
+
+static const char *const TAG = "mdns";
+
+void MDNSComponent::setup() {
+  this->compile_records_();
+  // Advertising is left to the host's own responder (e.g. avahi), the records are only compiled for dump_config()
+  ESP_LOGD(TAG, "mDNS is not advertised on the host platform");
+}
+
+}  // namespace mdns
+}  // namespace esphome
+
+#endif  // USE_HOST
@@ -1,5 +1,6 @@
 #include "modbus.h"
 #include "esphome/core/log.h"
+#include "esphome/core/crc.h"
 #include "esphome/core/helpers.h"
 
 namespace esphome {
@@ -16,7 +17,7 @@ void Modbus::loop() {
   const uint32_t now = millis();
 
   if (now - this->last_modbus_byte_ > 50) {
-    this->rx_buffer_.clear();
+    this->reset_frame_();
     this->last_modbus_byte_ = now;
   }
   // stop blocking new send commands after send_wait_time_ ms regardless if a response has been received since then
@@ -24,72 +25,70 @@ void Modbus::loop() {
     waiting_for_response = 0;
   }
 
-  while (this->available()) {
-    uint8_t byte;
-    this->read_byte(&byte);
-    if (this->parse_modbus_byte_(byte)) {
-      this->last_modbus_byte_ = now;
-    } else {
-      this->rx_buffer_.clear();
-    }
+  int available = this->available();
+  while (available > 0) {
+    const size_t len = std::min(this->bytes_needed_(), static_cast<size_t>(available));
+    if (!this->read_array(&this->rx_buffer_[this->rx_size_], len))
+      break;
+    available -= len;
+    this->rx_size_ += len;
+    this->last_modbus_byte_ = now;
+    if (!this->parse_modbus_frame_())
+      this->reset_frame_();
   }
 }
 
-uint16_t crc16(const uint8_t *data, uint8_t len) {
-  uint16_t crc = 0xFFFF;
-  while (len--) {
-    crc ^= *data++;
-    for (uint8_t i = 0; i < 8; i++) {
-      if ((crc & 0x01) != 0) {
-        crc >>= 1;
-        crc ^= 0xA001;
-      } else {
-        crc >>= 1;
-      }
-    }
-  }
-  return crc;
+uint16_t crc16(const uint8_t *data, uint8_t len) { return crc16_modbus(data, len); }
+
+// Per https://modbus.org/docs/Modbus_Application_Protocol_V1_1b3.pdf Ch 5 User-Defined function codes
+static bool is_user_defined_function(uint8_t function_code) {
+  return ((function_code >= 65) && (function_code <= 72)) || ((function_code >= 100) && (function_code <= 110));
+}
+
+void Modbus::reset_frame_() {
+  this->rx_size_ = 0;
+  this->frame_size_ = 0;
+  this->rx_crc_ = 0xFFFF;
 }
 
-bool Modbus::parse_modbus_byte_(uint8_t byte) {
-  size_t at = this->rx_buffer_.size();
-  this->rx_buffer_.push_back(byte);
-  const uint8_t *raw = &this->rx_buffer_[0];
-  ESP_LOGV(TAG, "Modbus received Byte  %d (0X%x)", byte, byte);
+size_t Modbus::bytes_needed_() const {
+  // Every frame starts with address, function code and a third byte, which is enough to know its length
+  if (this->rx_size_ < 3)
+    return 3 - this->rx_size_;
+  if (this->frame_size_ != 0)
+    return this->frame_size_ - this->rx_size_;
+  // User-defined function codes have no length, their end is found by checking the CRC after every byte
+  return 1;
+}
+
+bool Modbus::parse_modbus_frame_() {
+  const uint8_t *raw = this->rx_buffer_.data();
   // Byte 0: modbus address (match all)
-  if (at == 0)
-    return true;
-  uint8_t address = raw[0];
-  uint8_t function_code = raw[1];
+  // Byte 1: function code
   // Byte 2: Size (with modbus rtu function code 4/3)
   // See also https://en.wikipedia.org/wiki/Modbus
-  if (at == 2)
+  if (this->rx_size_ < 3)
     return true;
+  uint8_t address = raw[0];
+  uint8_t function_code = raw[1];
 
-  uint8_t data_len = raw[2];
-  uint8_t data_offset = 3;
+  size_t data_len = raw[2];
+  size_t data_offset = 3;
 
-  // Per https://modbus.org/docs/Modbus_Application_Protocol_V1_1b3.pdf Ch 5 User-Defined function codes
-  if (((function_code >= 65) && (function_code <= 72)) || ((function_code >= 100) && (function_code <= 110))) {
+  if (is_user_defined_function(function_code)) {
     // Handle user-defined function, since we don't know how big this ought to be,
     // ideally we should delegate the entire length detection to whatever handler is
     // installed, but wait, there is the CRC, and if we get a hit there is a good
     // chance that this is a complete message ... admittedly there is a small chance is
     // isn't but that is quite small given the purpose of the CRC in the first place
+    const size_t crc_pos = this->rx_size_ - 2;
+    this->rx_crc_ = crc16_update(this->rx_crc_, &raw[crc_pos - 1], 1);
+    uint16_t remote_crc = uint16_t(raw[crc_pos]) | (uint16_t(raw[crc_pos + 1]) << 8);
+    if (this->rx_crc_ != remote_crc)
+      return this->rx_size_ < MAX_FRAME_SIZE;
 
-    // Fewer than 2 bytes can't calc CRC
-    if (at < 2)
-      return true;
-
-    data_len = at - 2;
+    data_len = crc_pos - 1;
     data_offset = 1;
-
-    uint16_t computed_crc = crc16(raw, data_offset + data_len);
-    uint16_t remote_crc = uint16_t(raw[data_offset + data_len]) | (uint16_t(raw[data_offset + data_len + 1]) << 8);
-
-    if (computed_crc != remote_crc)
-      return true;
-
     ESP_LOGD(TAG, "Modbus user-defined function %02X found", function_code);
 
   } else {
@@ -106,23 +105,21 @@ bool Modbus::parse_modbus_byte_(uint8_t byte) {
       data_len = 1;
     }
 
-    // Byte data_offset..data_offset+data_len-1: Data
-    if (at < data_offset + data_len)
+    // Byte data_offset..data_offset+data_len-1: Data, followed by CRC_LO and CRC_HI (over all bytes)
+    this->frame_size_ = data_offset + data_len + 2;
+    if (this->rx_size_ < this->frame_size_)
       return true;
 
-    // Byte 3+data_len: CRC_LO (over all bytes)
-    if (at == data_offset + data_len)
-      return true;
-
-    // Byte data_offset+len+1: CRC_HI (over all bytes)
-    uint16_t computed_crc = crc16(raw, data_offset + data_len);
+    uint16_t computed_crc = crc16_modbus(raw, data_offset + data_len);
     uint16_t remote_crc = uint16_t(raw[data_offset + data_len]) | (uint16_t(raw[data_offset + data_len + 1]) << 8);
     if (computed_crc != remote_crc) {
       ESP_LOGW(TAG, "Modbus CRC Check failed! %02X!=%02X", computed_crc, remote_crc);
       return false;
     }
   }
-  std::vector<uint8_t> data(this->rx_buffer_.begin() + data_offset, this->rx_buffer_.begin() + data_offset + data_len);
+  ESP_LOGV(TAG, "Modbus received frame: %s", format_hex_pretty(raw, this->rx_size_).c_str());
+
+  this->frame_data_.assign(raw + data_offset, raw + data_offset + data_len);
   bool found = false;
   for (auto *device : this->devices_) {
     if (device->address_ == address) {
@@ -136,7 +133,7 @@ bool Modbus::parse_modbus_byte_(uint8_t byte) {
           ESP_LOGD(TAG, "Ignoring Modbus error - not expecting a response");
         }
       } else {
-        device->on_modbus_data(data);
+        device->on_modbus_data(this->frame_data_);
       }
       found = true;
     }
@@ -3,6 +3,8 @@
 #include "esphome/core/component.h"
 #include "esphome/components/uart/uart.h"
 
+#include <array>
+
 namespace esphome {
 namespace modbus {
 
@@ -32,9 +34,22 @@ class Modbus : public uart::UARTDevice, public Component {
  protected:
   GPIOPin *flow_control_pin_{nullptr};
 
-  bool parse_modbus_byte_(uint8_t byte);
+  /// Number of bytes to read for the current frame, whole frames are read at once once their length is known.
+  size_t bytes_needed_() const;
+  /// Check the frame received so far, returns false when the buffer should be reset (frame handled or invalid).
+  bool parse_modbus_frame_();
+  void reset_frame_();
   uint16_t send_wait_time_{250};
-  std::vector<uint8_t> rx_buffer_;
+  /// Largest frame: address, function code, byte count, 255 data bytes and the CRC.
+  static const size_t MAX_FRAME_SIZE = 260;
+  std::array<uint8_t, MAX_FRAME_SIZE> rx_buffer_;
+  size_t rx_size_{0};
+  /// Expected size of the current frame, 0 while it isn't known yet.
+  size_t frame_size_{0};
+  /// CRC over all but the last two received bytes, only kept for user-defined function codes.
+  uint16_t rx_crc_{0xFFFF};
+  /// Payload passed to devices, reused between frames.
+  std::vector<uint8_t> frame_data_;
   uint32_t last_modbus_byte_{0};
   uint32_t last_send_{0};
   std::vector<ModbusDevice *> devices_;
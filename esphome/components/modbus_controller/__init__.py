@@ -10,6 +10,8 @@ from .const import (
     CONF_COMMAND_THROTTLE,
     CONF_CUSTOM_COMMAND,
     CONF_FORCE_NEW_RANGE,
+    CONF_MAX_REGISTER_GAP,
+    CONF_MAX_REGISTERS_PER_REQUEST,
     CONF_MODBUS_CONTROLLER_ID,
     CONF_REGISTER_COUNT,
     CONF_REGISTER_TYPE,
@@ -105,6 +107,10 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(
                 CONF_COMMAND_THROTTLE, default="0ms"
             ): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_MAX_REGISTER_GAP, default=0): cv.int_range(min=0, max=124),
+            cv.Optional(CONF_MAX_REGISTERS_PER_REQUEST, default=125): cv.int_range(
+                min=1, max=125
+            ),
         }
     )
     .extend(cv.polling_component_schema("60s"))
@@ -209,6 +215,8 @@ async def add_modbus_base_properties(
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID], config[CONF_COMMAND_THROTTLE])
     cg.add(var.set_command_throttle(config[CONF_COMMAND_THROTTLE]))
+    cg.add(var.set_max_register_gap(config[CONF_MAX_REGISTER_GAP]))
+    cg.add(var.set_max_registers_per_request(config[CONF_MAX_REGISTERS_PER_REQUEST]))
     await register_modbus_device(var, config)
 
 
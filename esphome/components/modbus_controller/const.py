@@ -3,6 +3,8 @@ CONF_BYTE_OFFSET = "byte_offset"
 CONF_COMMAND_THROTTLE = "command_throttle"
 CONF_CUSTOM_COMMAND = "custom_command"
 CONF_FORCE_NEW_RANGE = "force_new_range"
+CONF_MAX_REGISTER_GAP = "max_register_gap"
+CONF_MAX_REGISTERS_PER_REQUEST = "max_registers_per_request"
 CONF_MODBUS_CONTROLLER_ID = "modbus_controller_id"
 CONF_MODBUS_FUNCTIONCODE = "modbus_functioncode"
 CONF_RAW_ENCODE = "raw_encode"
@@ -2,6 +2,8 @@
 #include "esphome/core/application.h"
 #include "esphome/core/log.h"
 
+#include <limits>
+
 namespace esphome {
 namespace modbus_controller {
 
@@ -36,6 +38,8 @@ bool ModbusController::send_next_command_() {
                command->register_address, command->register_count);
       command->send();
       this->last_command_timestamp_ = millis();
+      this->cycle_requests_++;
+      this->cycle_tx_bytes_ += command->get_request_size();
       // remove from queue if no handler is defined
       if (!command->on_data_func) {
         command_queue_.pop_front();
@@ -50,6 +54,8 @@ void ModbusController::on_modbus_data(const std::vector<uint8_t> &data) {
   auto &current_command = this->command_queue_.front();
   if (current_command != nullptr) {
     // Move the commandItem to the response queue
+    // address, function code, (byte count) and CRC around the data
+    this->cycle_rx_bytes_ += data.size() + (current_command->is_read_command() ? 5 : 4);
     current_command->payload = data;
     this->incoming_queue_.push(std::move(current_command));
     ESP_LOGV(TAG, "Modbus response queued");
@@ -157,6 +163,13 @@ void ModbusController::update() {
   } else {
     ESP_LOGV(TAG, "Updating modbus component");
   }
+  if (this->cycle_requests_ > 0) {
+    ESP_LOGD(TAG, "Last cycle of device %d: %zu requests, %zu bytes sent, %zu bytes received", this->address_,
+             this->cycle_requests_, this->cycle_tx_bytes_, this->cycle_rx_bytes_);
+  }
+  this->cycle_requests_ = 0;
+  this->cycle_tx_bytes_ = 0;
+  this->cycle_rx_bytes_ = 0;
 
   for (auto &r : this->register_ranges_) {
     ESP_LOGVV(TAG, "Updating range 0x%X", r.start_address);
@@ -175,7 +188,7 @@ size_t ModbusController::create_register_ranges_() {
   // iterator is sorted see SensorItemsComparator for details
   auto ix = sensorset_.begin();
   RegisterRange r = {};
-  uint8_t buffer_offset = 0;
+  uint16_t buffer_offset = 0;
   SensorItem *prev = nullptr;
   while (ix != sensorset_.end()) {
     SensorItem *curr = *ix;
@@ -215,22 +228,24 @@ size_t ModbusController::create_register_ranges_() {
 
           ESP_LOGV(TAG, "Re-use previous register - change to register: 0x%X %d offset=%u", curr->start_address,
                    curr->register_count, curr->offset);
-        } else if (curr->start_address == (r.start_address + r.register_count)) {
-          // this register can extend the current range
+        } else if (this->can_extend_range_(r, *curr)) {
+          // this register can extend the current range, registers in a gap are read and skipped
+          const uint16_t gap = curr->start_address - (r.start_address + r.register_count);
 
           // remove this sensore because start_address is changed (sort-order)
           ix = sensorset_.erase(ix);
 
           curr->start_address = r.start_address;
+          buffer_offset += gap * 2;
           curr->offset += buffer_offset;
           buffer_offset += curr->get_register_size();
-          r.register_count += curr->register_count;
+          r.register_count += gap + curr->register_count;
 
           sensorset_.insert(curr);
           // move iterator backwards because it will be incremented later
           ix--;
 
-          ESP_LOGV(TAG, "Extend range - change to register: 0x%X %d offset=%u", curr->start_address,
+          ESP_LOGV(TAG, "Extend range (gap %u) - change to register: 0x%X %d offset=%u", gap, curr->start_address,
                    curr->register_count, curr->offset);
         }
       }
@@ -271,9 +286,27 @@ size_t ModbusController::create_register_ranges_() {
   return register_ranges_.size();
 }
 
+bool ModbusController::can_extend_range_(const RegisterRange &r, const SensorItem &item) const {
+  const uint16_t end = r.start_address + r.register_count;
+  if (item.start_address < end)
+    return false;
+  const uint16_t gap = item.start_address - end;
+  const uint16_t count = r.register_count + gap + item.register_count;
+  if (r.register_type != ModbusRegisterType::HOLDING && r.register_type != ModbusRegisterType::READ) {
+    // coils and discrete inputs are packed as bits, only extend them with the adjacent ones
+    return gap == 0 && count <= std::numeric_limits<uint8_t>::max();
+  }
+  if (count > this->max_registers_per_request_)
+    return false;
+  // registers skipped in a gap are assumed to be 2 bytes, which doesn't hold for devices with a custom response size
+  return gap == 0 || (gap <= this->max_register_gap_ && item.get_register_size() == item.register_count * 2u);
+}
+
 void ModbusController::dump_config() {
   ESP_LOGCONFIG(TAG, "ModbusController:");
   ESP_LOGCONFIG(TAG, "  Address: 0x%02X", this->address_);
+  ESP_LOGCONFIG(TAG, "  Max register gap: %u", this->max_register_gap_);
+  ESP_LOGCONFIG(TAG, "  Max registers per request: %u", this->max_registers_per_request_);
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
   ESP_LOGCONFIG(TAG, "sensormap");
   for (auto &it : sensorset_) {
@@ -291,16 +324,14 @@ void ModbusController::dump_config() {
 
 void ModbusController::loop() {
   // Incoming data to process?
-  if (!incoming_queue_.empty()) {
+  while (!incoming_queue_.empty()) {
     auto &message = incoming_queue_.front();
     if (message != nullptr)
       process_modbus_data_(message.get());
     incoming_queue_.pop();
-
-  } else {
-    // all messages processed send pending commands
-    send_next_command_();
   }
+  // all messages processed send pending commands, without waiting for the next loop
+  send_next_command_();
 }
 
 void ModbusController::on_write_register_response(ModbusRegisterType register_type, uint16_t start_address,
@@ -488,6 +519,27 @@ bool ModbusCommandItem::send() {
   return true;
 }
 
+size_t ModbusCommandItem::get_request_size() const {
+  if (this->function_code == ModbusFunctionCode::CUSTOM)
+    return this->payload.size() + 2;
+  // address, function code, register address and CRC
+  size_t size = 6;
+  switch (this->function_code) {
+    case ModbusFunctionCode::WRITE_SINGLE_COIL:
+    case ModbusFunctionCode::WRITE_SINGLE_REGISTER:
+      size += 2;
+      break;
+    case ModbusFunctionCode::WRITE_MULTIPLE_COILS:
+    case ModbusFunctionCode::WRITE_MULTIPLE_REGISTERS:
+      size += 3 + this->payload.size();
+      break;
+    default:
+      size += 2;
+      break;
+  }
+  return size;
+}
+
 bool ModbusCommandItem::is_equal(const ModbusCommandItem &other) {
   // for custom commands we have to check for identical payloads, since
   // address/count/type fields will be set to zero
@@ -306,6 +306,13 @@ class ModbusCommandItem {
       on_data_func;
   std::vector<uint8_t> payload = {};
   bool send();
+  /// Whether the command reads registers (function codes 01-04)
+  bool is_read_command() const {
+    return this->function_code != ModbusFunctionCode::CUSTOM &&
+           uint8_t(this->function_code) <= uint8_t(ModbusFunctionCode::READ_INPUT_REGISTERS);
+  }
+  /// Number of bytes send() puts on the wire (including address and CRC)
+  size_t get_request_size() const;
   // wrong commands (esp. custom commands) can block the send queue
   // limit the number of repeats
   uint8_t send_countdown{MAX_SEND_REPEATS};
@@ -431,12 +438,18 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
                                   const std::vector<uint8_t> &data);
   /// called by esphome generated code to set the command_throttle period
   void set_command_throttle(uint16_t command_throttle) { this->command_throttle_ = command_throttle; }
+  /// called by esphome generated code to set the number of unused registers a range may span to merge reads
+  void set_max_register_gap(uint16_t max_register_gap) { this->max_register_gap_ = max_register_gap; }
+  /// called by esphome generated code to limit the number of registers read with one command
+  void set_max_registers_per_request(uint16_t max_registers) { this->max_registers_per_request_ = max_registers; }
 
  protected:
   /// parse sensormap_ and create range of sequential addresses
   size_t create_register_ranges_();
   // find register in sensormap. Returns iterator with all registers having the same start address
   SensorSet find_sensors_(ModbusRegisterType register_type, uint16_t start_address) const;
+  /// check if the sensor can be read with the range (adjacent or within the allowed gap)
+  bool can_extend_range_(const RegisterRange &r, const SensorItem &item) const;
   /// submit the read command for the address range to the send queue
   void update_range_(RegisterRange &r);
   /// parse incoming modbus data
@@ -459,6 +472,14 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   uint32_t last_command_timestamp_;
   /// min time in ms between sending modbus commands
   uint16_t command_throttle_;
+  /// max number of unused registers between two sensors that are still read with one command
+  uint16_t max_register_gap_{0};
+  /// max number of registers read with one command (125 per the modbus specification)
+  uint16_t max_registers_per_request_{125};
+  /// commands and bytes on the wire since the last update
+  size_t cycle_requests_{0};
+  size_t cycle_tx_bytes_{0};
+  size_t cycle_rx_bytes_{0};
 };
 
 /** Convert vector<uint8_t> response payload to float.
@@ -47,10 +47,10 @@ class MopekaProCheck : public Component, public esp32_ble_tracker::ESPBTDeviceLi
   uint32_t full_mm_;
   uint32_t empty_mm_;
 
-  uint8_t parse_battery_level_(const std::vector<uint8_t> &message);
-  uint32_t parse_distance_(const std::vector<uint8_t> &message);
-  uint8_t parse_temperature_(const std::vector<uint8_t> &message);
-  SensorReadQuality parse_read_quality_(const std::vector<uint8_t> &message);
+  uint8_t parse_battery_level_(const esp32_ble_tracker::AdvDataView &message);
+  uint32_t parse_distance_(const esp32_ble_tracker::AdvDataView &message);
+  uint8_t parse_temperature_(const esp32_ble_tracker::AdvDataView &message);
+  SensorReadQuality parse_read_quality_(const esp32_ble_tracker::AdvDataView &message);
 };
 
 }  // namespace mopeka_pro_check
@@ -13,6 +13,7 @@ from esphome.const import (
     CONF_VARIANT,
     CONF_OUTPUT_ID,
     CONF_INVERT,
+    CONF_MAX_REFRESH_RATE,
 )
 from esphome.components.esp32 import get_esp32_variant
 from esphome.components.esp32.const import (
@@ -184,6 +185,7 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_CLOCK_PIN): pins.internal_gpio_output_pin_number,
             cv.Optional(CONF_DATA_PIN): pins.internal_gpio_output_pin_number,
             cv.Required(CONF_NUM_LEDS): cv.positive_not_null_int,
+            cv.Optional(CONF_MAX_REFRESH_RATE): cv.positive_time_period_microseconds,
         }
     ).extend(cv.COMPONENT_SCHEMA),
     _choose_default_method,
@@ -219,5 +221,8 @@ async def to_code(config):
 
     cg.add(var.set_pixel_order(getattr(ESPNeoPixelOrder, config[CONF_TYPE])))
 
+    if CONF_MAX_REFRESH_RATE in config:
+        cg.add(var.set_max_refresh_rate(config[CONF_MAX_REFRESH_RATE]))
+
     # https://github.com/Makuna/NeoPixelBus/blob/master/library.json
     cg.add_library("makuna/NeoPixelBus", "2.6.9")
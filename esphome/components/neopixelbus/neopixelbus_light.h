@@ -82,16 +82,30 @@ class NeoPixelBusLightOutputBase : public light::AddressableLight {
   }
 
   void write_state(light::LightState *state) override {
-    this->mark_shown_();
-    this->controller_->Dirty();
+    // the previous frame never made it to the strip
+    if (this->frame_pending_)
+      this->count_frame_dropped_();
+    this->frame_pending_ = true;
+    this->show_pending_();
+    if (this->frame_pending_)
+      this->enable_loop();
+  }
 
-    this->controller_->Show();
+  void loop() override {
+    // retry here so that a frame held back won't get lost
+    if (this->frame_pending_)
+      this->show_pending_();
+    if (!this->frame_pending_)
+      this->disable_loop();
   }
 
   float get_setup_priority() const override { return setup_priority::HARDWARE; }
 
   int32_t size() const override { return this->controller_->PixelCount(); }
 
+  /// Set a maximum refresh rate in µs as some lights do not like being updated too often.
+  void set_max_refresh_rate(uint32_t interval_us) { this->max_refresh_rate_ = interval_us; }
+
   void set_pixel_order(ESPNeoPixelOrder order) {
     uint8_t u_order = static_cast<uint8_t>(order);
     this->rgb_offsets_[0] = (u_order >> 6) & 0b11;
@@ -101,9 +115,30 @@ class NeoPixelBusLightOutputBase : public light::AddressableLight {
   }
 
  protected:
+  /// Send the pending frame if the refresh rate and the strip allow it, otherwise leave it for the next loop.
+  void show_pending_() {
+    uint32_t now = micros();
+    if (this->max_refresh_rate_ != 0 && (now - this->last_refresh_) < this->max_refresh_rate_)
+      return;
+    // The DMA, I2S, RMT and async UART methods send from a buffer of their own while the pixels are edited for the
+    // next frame, Show() would block until the previous frame is out.
+    if (!this->controller_->CanShow())
+      return;
+    this->last_refresh_ = now;
+    this->frame_pending_ = false;
+    this->count_frame_shown_();
+    this->mark_shown_();
+    this->controller_->Dirty();
+
+    this->controller_->Show();
+  }
+
   NeoPixelBus<T_COLOR_FEATURE, T_METHOD> *controller_{nullptr};
   uint8_t *effect_data_{nullptr};
   uint8_t rgb_offsets_[4]{0, 1, 2, 3};
+  uint32_t max_refresh_rate_{0};
+  uint32_t last_refresh_{0};
+  bool frame_pending_{false};
 };
 
 template<typename T_METHOD, typename T_COLOR_FEATURE = NeoRgbFeature>
@@ -121,6 +156,17 @@ class NeoPixelRGBLightOutput : public NeoPixelBusLightOutputBase<T_METHOD, T_COL
     return light::ESPColorView(base + this->rgb_offsets_[0], base + this->rgb_offsets_[1], base + this->rgb_offsets_[2],
                                nullptr, this->effect_data_ + index, &this->correction_);
   }
+  bool get_span_internal(int32_t index, int32_t max_size, light::ESPPixelSpan *span) const override {  // NOLINT
+    span->pixels = this->controller_->Pixels() + 3ULL * index;
+    span->stride = 3;
+    span->red = this->rgb_offsets_[0];
+    span->green = this->rgb_offsets_[1];
+    span->blue = this->rgb_offsets_[2];
+    span->white = -1;
+    span->effect_data = this->effect_data_ + index;
+    span->size = std::min(max_size, this->size() - index);
+    return true;
+  }
 };
 
 template<typename T_METHOD, typename T_COLOR_FEATURE = NeoRgbwFeature>
@@ -138,6 +184,17 @@ class NeoPixelRGBWLightOutput : public NeoPixelBusLightOutputBase<T_METHOD, T_CO
     return light::ESPColorView(base + this->rgb_offsets_[0], base + this->rgb_offsets_[1], base + this->rgb_offsets_[2],
                                base + this->rgb_offsets_[3], this->effect_data_ + index, &this->correction_);
   }
+  bool get_span_internal(int32_t index, int32_t max_size, light::ESPPixelSpan *span) const override {  // NOLINT
+    span->pixels = this->controller_->Pixels() + 4ULL * index;
+    span->stride = 4;
+    span->red = this->rgb_offsets_[0];
+    span->green = this->rgb_offsets_[1];
+    span->blue = this->rgb_offsets_[2];
+    span->white = this->rgb_offsets_[3];
+    span->effect_data = this->effect_data_ + index;
+    span->size = std::min(max_size, this->size() - index);
+    return true;
+  }
 };
 
 }  // namespace neopixelbus
@@ -13,6 +13,10 @@ namespace esphome {
 namespace network {
 
 bool is_connected() {
+#ifdef USE_HOST
+  return true;  // the host's network is managed by the operating system
+#endif
+
 #ifdef USE_ETHERNET
   if (ethernet::global_eth_component != nullptr && ethernet::global_eth_component->is_connected())
     return true;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <utility>
 
 #include "esphome/core/component.h"
@@ -59,6 +60,31 @@ class PartitionLightOutput : public light::AddressableLight {
 
  protected:
   light::ESPColorView get_view_internal(int32_t index) const override {
+    auto &seg = this->find_segment_(index);
+    // offset within the segment
+    int32_t seg_off = index - seg.get_dst_offset();
+    // offset within the src
+    int32_t src_off;
+    if (seg.is_reversed()) {
+      src_off = seg.get_src_offset() + seg.get_size() - seg_off - 1;
+    } else {
+      src_off = seg.get_src_offset() + seg_off;
+    }
+
+    auto view = (*seg.get_src())[src_off];
+    view.raw_set_color_correction(&this->correction_);
+    return view;
+  }
+  bool get_span_internal(int32_t index, int32_t max_size, light::ESPPixelSpan *span) const override {
+    auto &seg = this->find_segment_(index);
+    // reversed segments are handled per LED through get_view_internal()
+    if (seg.is_reversed())
+      return false;
+    int32_t seg_off = index - seg.get_dst_offset();
+    max_size = std::min(max_size, seg.get_size() - seg_off);
+    return seg.get_src()->get_span(seg.get_src_offset() + seg_off, max_size, span);
+  }
+  const AddressableSegment &find_segment_(int32_t index) const {
     uint32_t lo = 0;
     uint32_t hi = this->segments_.size() - 1;
     while (lo < hi) {
@@ -73,20 +99,7 @@ class PartitionLightOutput : public light::AddressableLight {
         lo = hi = mid;
       }
     }
-    auto &seg = this->segments_[lo];
-    // offset within the segment
-    int32_t seg_off = index - seg.get_dst_offset();
-    // offset within the src
-    int32_t src_off;
-    if (seg.is_reversed()) {
-      src_off = seg.get_src_offset() + seg.get_size() - seg_off - 1;
-    } else {
-      src_off = seg.get_src_offset() + seg_off;
-    }
-
-    auto view = (*seg.get_src())[src_off];
-    view.raw_set_color_correction(&this->correction_);
-    return view;
+    return this->segments_[lo];
   }
 
   std::vector<AddressableSegment> segments_;
@@ -3,340 +3,471 @@
 #include "prometheus_handler.h"
 #include "esphome/core/application.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+
 namespace esphome {
 namespace prometheus {
 
-void PrometheusHandler::handleRequest(AsyncWebServerRequest *req) {
-  AsyncResponseStream *stream = req->beginResponseStream("text/plain; version=0.0.4; charset=utf-8");
+enum ScrapeSection : uint8_t {
+  SECTION_SENSOR,
+  SECTION_BINARY_SENSOR,
+  SECTION_FAN,
+  SECTION_LIGHT,
+  SECTION_COVER,
+  SECTION_SWITCH,
+  SECTION_LOCK,
+  SECTION_TEXT_SENSOR,
+  SECTION_NUMBER,
+  SECTION_SELECT,
+  SECTION_COUNT,
+};
+
+/// Append a label value, escaping backslashes, quotes and newlines.
+static void append_escaped(std::string &out, const std::string &value) {
+  for (char c : value) {
+    if (c == '\\' || c == '"') {
+      out += '\\';
+      out += c;
+    } else if (c == '\n') {
+      out += "\\n";
+    } else {
+      out += c;
+    }
+  }
+}
+
+/// Append "name{labels" of a row, the caller adds more labels and closes it.
+static void append_row_start(std::string &out, const char *name, const std::string &labels) {
+  out += name;
+  out += '{';
+  out += labels;
+}
+
+static void append_float(std::string &out, float value, int8_t accuracy_decimals = 2) {
+  if (accuracy_decimals < 0) {
+    auto multiplier = powf(10.0f, accuracy_decimals);
+    value = roundf(value * multiplier) / multiplier;
+    accuracy_decimals = 0;
+  }
+  char buf[32];
+  int len = snprintf(buf, sizeof(buf), "%.*f", accuracy_decimals, value);
+  out.append(buf, std::min<size_t>(len, sizeof(buf) - 1));
+}
 
+static void append_int(std::string &out, int value) {
+  char buf[12];
+  int len = snprintf(buf, sizeof(buf), "%d", value);
+  out.append(buf, len);
+}
+
+/// Append a row without extra labels.
+static void append_row(std::string &out, const char *name, const std::string &labels, const char *value) {
+  append_row_start(out, name, labels);
+  out += "} ";
+  out += value;
+  out += '\n';
+}
+
+void PrometheusHandler::setup() {
+  // Entities are registered before any component is set up, build the labels of all rows once
 #ifdef USE_SENSOR
-  this->sensor_type_(stream);
-  for (auto *obj : App.get_sensors())
-    this->sensor_row_(stream, obj);
+  this->add_labels_(App.get_sensors());
 #endif
-
 #ifdef USE_BINARY_SENSOR
-  this->binary_sensor_type_(stream);
-  for (auto *obj : App.get_binary_sensors())
-    this->binary_sensor_row_(stream, obj);
+  this->add_labels_(App.get_binary_sensors());
 #endif
-
 #ifdef USE_FAN
-  this->fan_type_(stream);
-  for (auto *obj : App.get_fans())
-    this->fan_row_(stream, obj);
+  this->add_labels_(App.get_fans());
 #endif
-
 #ifdef USE_LIGHT
-  this->light_type_(stream);
-  for (auto *obj : App.get_lights())
-    this->light_row_(stream, obj);
+  this->add_labels_(App.get_lights());
 #endif
-
 #ifdef USE_COVER
-  this->cover_type_(stream);
-  for (auto *obj : App.get_covers())
-    this->cover_row_(stream, obj);
+  this->add_labels_(App.get_covers());
 #endif
-
 #ifdef USE_SWITCH
-  this->switch_type_(stream);
-  for (auto *obj : App.get_switches())
-    this->switch_row_(stream, obj);
+  this->add_labels_(App.get_switches());
+#endif
+#ifdef USE_LOCK
+  this->add_labels_(App.get_locks());
 #endif
+#ifdef USE_TEXT_SENSOR
+  this->add_labels_(App.get_text_sensors());
+#endif
+#ifdef USE_NUMBER
+  this->add_labels_(App.get_numbers());
+#endif
+#ifdef USE_SELECT
+  this->add_labels_(App.get_selects());
+#endif
+  this->labels_.shrink_to_fit();
+
+  this->base_->init();
+  this->base_->add_handler(this);
+}
+
+template<typename T> void PrometheusHandler::add_labels_(const std::vector<T *> &objs) {
+  for (auto *obj : objs) {
+    if (!this->is_exported_(obj))
+      continue;
+    std::string labels = "id=\"";
+    labels += obj->get_object_id();
+    labels += "\",name=\"";
+    append_escaped(labels, obj->get_name());
+    labels += '"';
+    this->labels_.push_back(std::move(labels));
+  }
+}
+
+void PrometheusHandler::handleRequest(AsyncWebServerRequest *req) {
+  // The rows are generated while the response is sent, so only the current entity is ever buffered
+  auto state = std::make_shared<ScrapeState>();
+  AsyncWebServerResponse *response =
+      req->beginChunkedResponse("text/plain; version=0.0.4; charset=utf-8",
+                                [this, state](uint8_t *buffer, size_t max_len, size_t) -> size_t {
+                                  return this->fill_chunk_(*state, buffer, max_len);
+                                });
+  req->send(response);
+}
 
+size_t PrometheusHandler::fill_chunk_(ScrapeState &state, uint8_t *buffer, size_t max_len) {
+  size_t written = 0;
+  while (written < max_len) {
+    if (state.pending_pos == state.pending.size()) {
+      state.pending.clear();
+      state.pending_pos = 0;
+      if (!this->next_rows_(state))
+        break;
+      continue;
+    }
+    const size_t len = std::min(max_len - written, state.pending.size() - state.pending_pos);
+    memcpy(buffer + written, state.pending.data() + state.pending_pos, len);
+    written += len;
+    state.pending_pos += len;
+  }
+  return written;
+}
+
+bool PrometheusHandler::next_rows_(ScrapeState &state) {
+  for (; state.section < SECTION_COUNT; state.section++, state.index = 0, state.type_sent = false) {
+    switch (state.section) {
+#ifdef USE_SENSOR
+      case SECTION_SENSOR:
+        if (this->next_section_rows_(state, App.get_sensors(), &PrometheusHandler::sensor_type_,
+                                     &PrometheusHandler::sensor_row_))
+          return true;
+        break;
+#endif
+#ifdef USE_BINARY_SENSOR
+      case SECTION_BINARY_SENSOR:
+        if (this->next_section_rows_(state, App.get_binary_sensors(), &PrometheusHandler::binary_sensor_type_,
+                                     &PrometheusHandler::binary_sensor_row_))
+          return true;
+        break;
+#endif
+#ifdef USE_FAN
+      case SECTION_FAN:
+        if (this->next_section_rows_(state, App.get_fans(), &PrometheusHandler::fan_type_,
+                                     &PrometheusHandler::fan_row_))
+          return true;
+        break;
+#endif
+#ifdef USE_LIGHT
+      case SECTION_LIGHT:
+        if (this->next_section_rows_(state, App.get_lights(), &PrometheusHandler::light_type_,
+                                     &PrometheusHandler::light_row_))
+          return true;
+        break;
+#endif
+#ifdef USE_COVER
+      case SECTION_COVER:
+        if (this->next_section_rows_(state, App.get_covers(), &PrometheusHandler::cover_type_,
+                                     &PrometheusHandler::cover_row_))
+          return true;
+        break;
+#endif
+#ifdef USE_SWITCH
+      case SECTION_SWITCH:
+        if (this->next_section_rows_(state, App.get_switches(), &PrometheusHandler::switch_type_,
+                                     &PrometheusHandler::switch_row_))
+          return true;
+        break;
+#endif
 #ifdef USE_LOCK
-  this->lock_type_(stream);
-  for (auto *obj : App.get_locks())
-    this->lock_row_(stream, obj);
+      case SECTION_LOCK:
+        if (this->next_section_rows_(state, App.get_locks(), &PrometheusHandler::lock_type_,
+                                     &PrometheusHandler::lock_row_))
+          return true;
+        break;
+#endif
+#ifdef USE_TEXT_SENSOR
+      case SECTION_TEXT_SENSOR:
+        if (this->next_section_rows_(state, App.get_text_sensors(), &PrometheusHandler::text_sensor_type_,
+                                     &PrometheusHandler::text_sensor_row_))
+          return true;
+        break;
 #endif
+#ifdef USE_NUMBER
+      case SECTION_NUMBER:
+        if (this->next_section_rows_(state, App.get_numbers(), &PrometheusHandler::number_type_,
+                                     &PrometheusHandler::number_row_))
+          return true;
+        break;
+#endif
+#ifdef USE_SELECT
+      case SECTION_SELECT:
+        if (this->next_section_rows_(state, App.get_selects(), &PrometheusHandler::select_type_,
+                                     &PrometheusHandler::select_row_))
+          return true;
+        break;
+#endif
+      default:
+        break;
+    }
+  }
+  return false;
+}
 
-  req->send(stream);
+template<typename T>
+bool PrometheusHandler::next_section_rows_(ScrapeState &state, const std::vector<T *> &objs,
+                                           void (PrometheusHandler::*type)(std::string &),
+                                           void (PrometheusHandler::*row)(std::string &, const std::string &, T *)) {
+  if (!state.type_sent) {
+    state.type_sent = true;
+    (this->*type)(state.pending);
+    return true;
+  }
+  while (state.index < objs.size()) {
+    T *obj = objs[state.index++];
+    if (!this->is_exported_(obj))
+      continue;
+    // Entities are only registered at startup, so the labels are in the same order
+    if (state.labels >= this->labels_.size())
+      return false;
+    (this->*row)(state.pending, this->labels_[state.labels++], obj);
+    return true;
+  }
+  return false;
 }
 
 // Type-specific implementation
 #ifdef USE_SENSOR
-void PrometheusHandler::sensor_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_sensor_value GAUGE\n"));
-  stream->print(F("#TYPE esphome_sensor_failed GAUGE\n"));
+void PrometheusHandler::sensor_type_(std::string &out) {
+  out += "#TYPE esphome_sensor_value GAUGE\n";
+  out += "#TYPE esphome_sensor_failed GAUGE\n";
 }
-void PrometheusHandler::sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
+void PrometheusHandler::sensor_row_(std::string &out, const std::string &labels, sensor::Sensor *obj) {
   if (!std::isnan(obj->state)) {
     // We have a valid value, output this value
-    stream->print(F("esphome_sensor_failed{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\"} 0\n"));
+    append_row(out, "esphome_sensor_failed", labels, "0");
     // Data itself
-    stream->print(F("esphome_sensor_value{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\",unit=\""));
-    stream->print(obj->get_unit_of_measurement().c_str());
-    stream->print(F("\"} "));
-    stream->print(value_accuracy_to_string(obj->state, obj->get_accuracy_decimals()).c_str());
-    stream->print('\n');
+    append_row_start(out, "esphome_sensor_value", labels);
+    out += ",unit=\"";
+    append_escaped(out, obj->get_unit_of_measurement());
+    out += "\"} ";
+    append_float(out, obj->state, obj->get_accuracy_decimals());
+    out += '\n';
   } else {
     // Invalid state
-    stream->print(F("esphome_sensor_failed{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\"} 1\n"));
+    append_row(out, "esphome_sensor_failed", labels, "1");
   }
 }
 #endif
 
 // Type-specific implementation
 #ifdef USE_BINARY_SENSOR
-void PrometheusHandler::binary_sensor_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_binary_sensor_value GAUGE\n"));
-  stream->print(F("#TYPE esphome_binary_sensor_failed GAUGE\n"));
+void PrometheusHandler::binary_sensor_type_(std::string &out) {
+  out += "#TYPE esphome_binary_sensor_value GAUGE\n";
+  out += "#TYPE esphome_binary_sensor_failed GAUGE\n";
 }
-void PrometheusHandler::binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
+void PrometheusHandler::binary_sensor_row_(std::string &out, const std::string &labels,
+                                           binary_sensor::BinarySensor *obj) {
   if (obj->has_state()) {
     // We have a valid value, output this value
-    stream->print(F("esphome_binary_sensor_failed{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\"} 0\n"));
+    append_row(out, "esphome_binary_sensor_failed", labels, "0");
     // Data itself
-    stream->print(F("esphome_binary_sensor_value{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->state);
-    stream->print('\n');
+    append_row(out, "esphome_binary_sensor_value", labels, obj->state ? "1" : "0");
   } else {
     // Invalid state
-    stream->print(F("esphome_binary_sensor_failed{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\"} 1\n"));
+    append_row(out, "esphome_binary_sensor_failed", labels, "1");
   }
 }
 #endif
 
 #ifdef USE_FAN
-void PrometheusHandler::fan_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_fan_value GAUGE\n"));
-  stream->print(F("#TYPE esphome_fan_failed GAUGE\n"));
-  stream->print(F("#TYPE esphome_fan_speed GAUGE\n"));
-  stream->print(F("#TYPE esphome_fan_oscillation GAUGE\n"));
+void PrometheusHandler::fan_type_(std::string &out) {
+  out += "#TYPE esphome_fan_value GAUGE\n";
+  out += "#TYPE esphome_fan_failed GAUGE\n";
+  out += "#TYPE esphome_fan_speed GAUGE\n";
+  out += "#TYPE esphome_fan_oscillation GAUGE\n";
 }
-void PrometheusHandler::fan_row_(AsyncResponseStream *stream, fan::Fan *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
-  stream->print(F("esphome_fan_failed{id=\""));
-  stream->print(obj->get_object_id().c_str());
-  stream->print(F("\",name=\""));
-  stream->print(obj->get_name().c_str());
-  stream->print(F("\"} 0\n"));
+void PrometheusHandler::fan_row_(std::string &out, const std::string &labels, fan::Fan *obj) {
+  append_row(out, "esphome_fan_failed", labels, "0");
   // Data itself
-  stream->print(F("esphome_fan_value{id=\""));
-  stream->print(obj->get_object_id().c_str());
-  stream->print(F("\",name=\""));
-  stream->print(obj->get_name().c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->state);
-  stream->print('\n');
+  append_row(out, "esphome_fan_value", labels, obj->state ? "1" : "0");
   // Speed if available
   if (obj->get_traits().supports_speed()) {
-    stream->print(F("esphome_fan_speed{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->speed);
-    stream->print('\n');
+    append_row_start(out, "esphome_fan_speed", labels);
+    out += "} ";
+    append_int(out, obj->speed);
+    out += '\n';
   }
   // Oscillation if available
-  if (obj->get_traits().supports_oscillation()) {
-    stream->print(F("esphome_fan_oscillation{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->oscillating);
-    stream->print('\n');
-  }
+  if (obj->get_traits().supports_oscillation())
+    append_row(out, "esphome_fan_oscillation", labels, obj->oscillating ? "1" : "0");
 }
 #endif
 
 #ifdef USE_LIGHT
-void PrometheusHandler::light_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_light_state GAUGE\n"));
-  stream->print(F("#TYPE esphome_light_color GAUGE\n"));
-  stream->print(F("#TYPE esphome_light_effect_active GAUGE\n"));
+void PrometheusHandler::light_type_(std::string &out) {
+  out += "#TYPE esphome_light_state GAUGE\n";
+  out += "#TYPE esphome_light_color GAUGE\n";
+  out += "#TYPE esphome_light_effect_active GAUGE\n";
 }
-void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightState *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
+void PrometheusHandler::light_row_(std::string &out, const std::string &labels, light::LightState *obj) {
   // State
-  stream->print(F("esphome_light_state{id=\""));
-  stream->print(obj->get_object_id().c_str());
-  stream->print(F("\",name=\""));
-  stream->print(obj->get_name().c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->remote_values.is_on());
-  stream->print(F("\n"));
+  append_row(out, "esphome_light_state", labels, obj->remote_values.is_on() ? "1" : "0");
   // Brightness and RGBW
   light::LightColorValues color = obj->current_values;
   float brightness, r, g, b, w;
   color.as_brightness(&brightness);
   color.as_rgbw(&r, &g, &b, &w);
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(obj->get_object_id().c_str());
-  stream->print(F("\",name=\""));
-  stream->print(obj->get_name().c_str());
-  stream->print(F("\",channel=\"brightness\"} "));
-  stream->print(brightness);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(obj->get_object_id().c_str());
-  stream->print(F("\",name=\""));
-  stream->print(obj->get_name().c_str());
-  stream->print(F("\",channel=\"r\"} "));
-  stream->print(r);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(obj->get_object_id().c_str());
-  stream->print(F("\",name=\""));
-  stream->print(obj->get_name().c_str());
-  stream->print(F("\",channel=\"g\"} "));
-  stream->print(g);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(obj->get_object_id().c_str());
-  stream->print(F("\",name=\""));
-  stream->print(obj->get_name().c_str());
-  stream->print(F("\",channel=\"b\"} "));
-  stream->print(b);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(obj->get_object_id().c_str());
-  stream->print(F("\",name=\""));
-  stream->print(obj->get_name().c_str());
-  stream->print(F("\",channel=\"w\"} "));
-  stream->print(w);
-  stream->print(F("\n"));
+  const char *const channels[] = {"brightness", "r", "g", "b", "w"};
+  const float values[] = {brightness, r, g, b, w};
+  for (size_t i = 0; i < 5; i++) {
+    append_row_start(out, "esphome_light_color", labels);
+    out += ",channel=\"";
+    out += channels[i];
+    out += "\"} ";
+    append_float(out, values[i]);
+    out += '\n';
+  }
   // Effect
   std::string effect = obj->get_effect_name();
-  if (effect == "None") {
-    stream->print(F("esphome_light_effect_active{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\",effect=\"None\"} 0\n"));
-  } else {
-    stream->print(F("esphome_light_effect_active{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\",effect=\""));
-    stream->print(effect.c_str());
-    stream->print(F("\"} 1\n"));
-  }
+  append_row_start(out, "esphome_light_effect_active", labels);
+  out += ",effect=\"";
+  append_escaped(out, effect);
+  out += effect == "None" ? "\"} 0\n" : "\"} 1\n";
 }
 #endif
 
 #ifdef USE_COVER
-void PrometheusHandler::cover_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_cover_value GAUGE\n"));
-  stream->print(F("#TYPE esphome_cover_failed GAUGE\n"));
+void PrometheusHandler::cover_type_(std::string &out) {
+  out += "#TYPE esphome_cover_value GAUGE\n";
+  out += "#TYPE esphome_cover_failed GAUGE\n";
 }
-void PrometheusHandler::cover_row_(AsyncResponseStream *stream, cover::Cover *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
+void PrometheusHandler::cover_row_(std::string &out, const std::string &labels, cover::Cover *obj) {
   if (!std::isnan(obj->position)) {
     // We have a valid value, output this value
-    stream->print(F("esphome_cover_failed{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\"} 0\n"));
+    append_row(out, "esphome_cover_failed", labels, "0");
     // Data itself
-    stream->print(F("esphome_cover_value{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->position);
-    stream->print('\n');
+    append_row_start(out, "esphome_cover_value", labels);
+    out += "} ";
+    append_float(out, obj->position);
+    out += '\n';
     if (obj->get_traits().get_supports_tilt()) {
-      stream->print(F("esphome_cover_tilt{id=\""));
-      stream->print(obj->get_object_id().c_str());
-      stream->print(F("\",name=\""));
-      stream->print(obj->get_name().c_str());
-      stream->print(F("\"} "));
-      stream->print(obj->tilt);
-      stream->print('\n');
+      append_row_start(out, "esphome_cover_tilt", labels);
+      out += "} ";
+      append_float(out, obj->tilt);
+      out += '\n';
     }
   } else {
     // Invalid state
-    stream->print(F("esphome_cover_failed{id=\""));
-    stream->print(obj->get_object_id().c_str());
-    stream->print(F("\",name=\""));
-    stream->print(obj->get_name().c_str());
-    stream->print(F("\"} 1\n"));
+    append_row(out, "esphome_cover_failed", labels, "1");
   }
 }
 #endif
 
 #ifdef USE_SWITCH
-void PrometheusHandler::switch_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_switch_value GAUGE\n"));
-  stream->print(F("#TYPE esphome_switch_failed GAUGE\n"));
+void PrometheusHandler::switch_type_(std::string &out) {
+  out += "#TYPE esphome_switch_value GAUGE\n";
+  out += "#TYPE esphome_switch_failed GAUGE\n";
 }
-void PrometheusHandler::switch_row_(AsyncResponseStream *stream, switch_::Switch *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
-  stream->print(F("esphome_switch_failed{id=\""));
-  stream->print(obj->get_object_id().c_str());
-  stream->print(F("\",name=\""));
-  stream->print(obj->get_name().c_str());
-  stream->print(F("\"} 0\n"));
+void PrometheusHandler::switch_row_(std::string &out, const std::string &labels, switch_::Switch *obj) {
+  append_row(out, "esphome_switch_failed", labels, "0");
   // Data itself
-  stream->print(F("esphome_switch_value{id=\""));
-  stream->print(obj->get_object_id().c_str());
-  stream->print(F("\",name=\""));
-  stream->print(obj->get_name().c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->state);
-  stream->print('\n');
+  append_row(out, "esphome_switch_value", labels, obj->state ? "1" : "0");
 }
 #endif
 
 #ifdef USE_LOCK
-void PrometheusHandler::lock_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_lock_value GAUGE\n"));
-  stream->print(F("#TYPE esphome_lock_failed GAUGE\n"));
+void PrometheusHandler::lock_type_(std::string &out) {
+  out += "#TYPE esphome_lock_value GAUGE\n";
+  out += "#TYPE esphome_lock_failed GAUGE\n";
 }
-void PrometheusHandler::lock_row_(AsyncResponseStream *stream, lock::Lock *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
-  stream->print(F("esphome_lock_failed{id=\""));
-  stream->print(obj->get_object_id().c_str());
-  stream->print(F("\",name=\""));
-  stream->print(obj->get_name().c_str());
-  stream->print(F("\"} 0\n"));
+void PrometheusHandler::lock_row_(std::string &out, const std::string &labels, lock::Lock *obj) {
+  append_row(out, "esphome_lock_failed", labels, "0");
   // Data itself
-  stream->print(F("esphome_lock_value{id=\""));
-  stream->print(obj->get_object_id().c_str());
-  stream->print(F("\",name=\""));
-  stream->print(obj->get_name().c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->state);
-  stream->print('\n');
+  append_row_start(out, "esphome_lock_value", labels);
+  out += "} ";
+  append_int(out, obj->state);
+  out += '\n';
+}
+#endif
+
+#ifdef USE_TEXT_SENSOR
+void PrometheusHandler::text_sensor_type_(std::string &out) {
+  out += "#TYPE esphome_text_sensor_value GAUGE\n";
+  out += "#TYPE esphome_text_sensor_failed GAUGE\n";
+}
+void PrometheusHandler::text_sensor_row_(std::string &out, const std::string &labels, text_sensor::TextSensor *obj) {
+  if (obj->has_state()) {
+    // We have a valid value, output this value
+    append_row(out, "esphome_text_sensor_failed", labels, "0");
+    // Data itself, as a label of an info-style metric
+    append_row_start(out, "esphome_text_sensor_value", labels);
+    out += ",value=\"";
+    append_escaped(out, obj->state);
+    out += "\"} 1\n";
+  } else {
+    // Invalid state
+    append_row(out, "esphome_text_sensor_failed", labels, "1");
+  }
+}
+#endif
+
+#ifdef USE_NUMBER
+void PrometheusHandler::number_type_(std::string &out) {
+  out += "#TYPE esphome_number_value GAUGE\n";
+  out += "#TYPE esphome_number_failed GAUGE\n";
+}
+void PrometheusHandler::number_row_(std::string &out, const std::string &labels, number::Number *obj) {
+  if (obj->has_state() && !std::isnan(obj->state)) {
+    // We have a valid value, output this value
+    append_row(out, "esphome_number_failed", labels, "0");
+    // Data itself
+    append_row_start(out, "esphome_number_value", labels);
+    out += "} ";
+    append_float(out, obj->state);
+    out += '\n';
+  } else {
+    // Invalid state
+    append_row(out, "esphome_number_failed", labels, "1");
+  }
+}
+#endif
+
+#ifdef USE_SELECT
+void PrometheusHandler::select_type_(std::string &out) {
+  out += "#TYPE esphome_select_value GAUGE\n";
+  out += "#TYPE esphome_select_failed GAUGE\n";
+}
+void PrometheusHandler::select_row_(std::string &out, const std::string &labels, select::Select *obj) {
+  if (obj->has_state()) {
+    // We have a valid value, output this value
+    append_row(out, "esphome_select_failed", labels, "0");
+    // Data itself, as a label of an info-style metric
+    append_row_start(out, "esphome_select_value", labels);
+    out += ",value=\"";
+    append_escaped(out, obj->state);
+    out += "\"} 1\n";
+  } else {
+    // Invalid state
+    append_row(out, "esphome_select_failed", labels, "1");
+  }
 }
 #endif
 
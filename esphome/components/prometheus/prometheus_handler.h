@@ -5,6 +5,10 @@
 #include "esphome/components/web_server_base/web_server_base.h"
 #include "esphome/core/controller.h"
 #include "esphome/core/component.h"
+#include "esphome/core/entity_base.h"
+
+#include <string>
+#include <vector>
 
 namespace esphome {
 namespace prometheus {
@@ -31,67 +35,111 @@ class PrometheusHandler : public AsyncWebHandler, public Component {
 
   void handleRequest(AsyncWebServerRequest *req) override;
 
-  void setup() override {
-    this->base_->init();
-    this->base_->add_handler(this);
-  }
+  void setup() override;
   float get_setup_priority() const override {
     // After WiFi
     return setup_priority::WIFI - 1.0f;
   }
 
  protected:
+  /// Position of a scrape, the response is generated in chunks as the web server asks for them.
+  struct ScrapeState {
+    uint8_t section{0};
+    /// Next entity of the section to export.
+    size_t index{0};
+    /// Labels of the next exported entity.
+    size_t labels{0};
+    bool type_sent{false};
+    /// Rows of the current entity that didn't fit into the previous chunk.
+    std::string pending;
+    size_t pending_pos{0};
+  };
+
+  /// Fill a chunk of the response, returns 0 when the scrape is complete.
+  size_t fill_chunk_(ScrapeState &state, uint8_t *buffer, size_t max_len);
+  /// Generate the type header of the next section or the rows of the next entity, false when done.
+  bool next_rows_(ScrapeState &state);
+  template<typename T>
+  bool next_section_rows_(ScrapeState &state, const std::vector<T *> &objs,
+                          void (PrometheusHandler::*type)(std::string &),
+                          void (PrometheusHandler::*row)(std::string &, const std::string &, T *));
+  template<typename T> void add_labels_(const std::vector<T *> &objs);
+  bool is_exported_(EntityBase *obj) const { return !obj->is_internal() || this->include_internal_; }
+
 #ifdef USE_SENSOR
   /// Return the type for prometheus
-  void sensor_type_(AsyncResponseStream *stream);
+  void sensor_type_(std::string &out);
   /// Return the sensor state as prometheus data point
-  void sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj);
+  void sensor_row_(std::string &out, const std::string &labels, sensor::Sensor *obj);
 #endif
 
 #ifdef USE_BINARY_SENSOR
   /// Return the type for prometheus
-  void binary_sensor_type_(AsyncResponseStream *stream);
+  void binary_sensor_type_(std::string &out);
   /// Return the sensor state as prometheus data point
-  void binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj);
+  void binary_sensor_row_(std::string &out, const std::string &labels, binary_sensor::BinarySensor *obj);
 #endif
 
 #ifdef USE_FAN
   /// Return the type for prometheus
-  void fan_type_(AsyncResponseStream *stream);
+  void fan_type_(std::string &out);
   /// Return the sensor state as prometheus data point
-  void fan_row_(AsyncResponseStream *stream, fan::Fan *obj);
+  void fan_row_(std::string &out, const std::string &labels, fan::Fan *obj);
 #endif
 
 #ifdef USE_LIGHT
   /// Return the type for prometheus
-  void light_type_(AsyncResponseStream *stream);
+  void light_type_(std::string &out);
   /// Return the Light Values state as prometheus data point
-  void light_row_(AsyncResponseStream *stream, light::LightState *obj);
+  void light_row_(std::string &out, const std::string &labels, light::LightState *obj);
 #endif
 
 #ifdef USE_COVER
   /// Return the type for prometheus
-  void cover_type_(AsyncResponseStream *stream);
+  void cover_type_(std::string &out);
   /// Return the switch Values state as prometheus data point
-  void cover_row_(AsyncResponseStream *stream, cover::Cover *obj);
+  void cover_row_(std::string &out, const std::string &labels, cover::Cover *obj);
 #endif
 
 #ifdef USE_SWITCH
   /// Return the type for prometheus
-  void switch_type_(AsyncResponseStream *stream);
+  void switch_type_(std::string &out);
   /// Return the switch Values state as prometheus data point
-  void switch_row_(AsyncResponseStream *stream, switch_::Switch *obj);
+  void switch_row_(std::string &out, const std::string &labels, switch_::Switch *obj);
 #endif
 
 #ifdef USE_LOCK
   /// Return the type for prometheus
-  void lock_type_(AsyncResponseStream *stream);
+  void lock_type_(std::string &out);
   /// Return the lock Values state as prometheus data point
-  void lock_row_(AsyncResponseStream *stream, lock::Lock *obj);
+  void lock_row_(std::string &out, const std::string &labels, lock::Lock *obj);
+#endif
+
+#ifdef USE_TEXT_SENSOR
+  /// Return the type for prometheus
+  void text_sensor_type_(std::string &out);
+  /// Return the text sensor state as prometheus data point
+  void text_sensor_row_(std::string &out, const std::string &labels, text_sensor::TextSensor *obj);
+#endif
+
+#ifdef USE_NUMBER
+  /// Return the type for prometheus
+  void number_type_(std::string &out);
+  /// Return the number state as prometheus data point
+  void number_row_(std::string &out, const std::string &labels, number::Number *obj);
+#endif
+
+#ifdef USE_SELECT
+  /// Return the type for prometheus
+  void select_type_(std::string &out);
+  /// Return the select state as prometheus data point
+  void select_row_(std::string &out, const std::string &labels, select::Select *obj);
 #endif
 
   web_server_base::WebServerBase *base_;
   bool include_internal_{false};
+  /// Label set (id and escaped name) of every exported entity, in scrape order.
+  std::vector<std::string> labels_;
 };
 
 }  // namespace prometheus
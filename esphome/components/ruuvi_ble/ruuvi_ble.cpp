@@ -8,7 +8,7 @@ namespace ruuvi_ble {
 
 static const char *const TAG = "ruuvi_ble";
 
-bool parse_ruuvi_data_byte(const esp32_ble_tracker::adv_data_t &adv_data, RuuviParseResult &result) {
+bool parse_ruuvi_data_byte(const esp32_ble_tracker::AdvDataView &adv_data, RuuviParseResult &result) {
   const uint8_t data_type = adv_data[0];
   const auto *data = &adv_data[1];
   switch (data_type) {
@@ -2,8 +2,12 @@
 
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
+#include "esphome/core/ring_buffer.h"
+#include <cmath>
+#include <functional>
 #include <queue>
 #include <utility>
+#include <vector>
 
 namespace esphome {
 namespace sensor {
@@ -42,6 +46,70 @@ class Filter {
   Sensor *parent_{nullptr};
 };
 
+/** The values of a sliding window in sorted order, for order statistics such as the median.
+ *
+ * Storage is allocated once for the window size. Adding a value removes the oldest one from the sorted values and
+ * inserts the new one, each a binary search and a move of the values behind it, instead of sorting a copy of the
+ * window for every output. NaN values take up their place in the window but are not part of the sorted values.
+ */
+class SortedWindow {
+ public:
+  void set_window_size(size_t window_size);
+  void push(float value);
+  /// Number of values in the window that are not NaN.
+  size_t size() const { return this->sorted_.size(); }
+  /// The index-th smallest value of the window, index must be less than size().
+  float operator[](size_t index) const { return this->sorted_[index]; }
+
+ protected:
+  /// The values in the order they arrived.
+  RingBuffer<float> window_;
+  std::vector<float> sorted_;
+};
+
+/** The minimum (with std::less) or maximum (with std::greater) of a sliding window.
+ *
+ * Keeps a monotonic queue of the values that can still become the extremum, each value is added and removed at most
+ * once, so a new value costs amortized O(1) and the extremum is always at the front. NaN values are ignored, but take
+ * up their place in the window.
+ */
+template<typename Compare> class MonotonicWindow {
+ public:
+  void set_window_size(size_t window_size) {
+    this->window_size_ = window_size;
+    // Only entries within the new window remain, which is at most window_size of them
+    this->expire_();
+    this->entries_.resize(window_size);
+  }
+  void push(float value) {
+    this->pushed_++;
+    this->expire_();
+    if (std::isnan(value))
+      return;
+    // Values that are not better than the new one can never be the extremum again
+    while (!this->entries_.empty() && !Compare()(this->entries_.back().value, value))
+      this->entries_.pop_back();
+    this->entries_.push_back(Entry{value, this->pushed_});
+  }
+  /// The extremum of the window, NaN if there are only NaN values.
+  float value() const { return this->entries_.empty() ? NAN : this->entries_.front().value; }
+
+ protected:
+  struct Entry {
+    float value;
+    uint32_t index;
+  };
+
+  void expire_() {
+    while (!this->entries_.empty() && this->pushed_ - this->entries_.front().index >= this->window_size_)
+      this->entries_.pop_front();
+  }
+
+  RingBuffer<Entry> entries_;
+  size_t window_size_{0};
+  uint32_t pushed_{0};
+};
+
 /** Simple quantile filter.
  *
  * Takes the quantile of the last <send_every> values and pushes it out every <send_every>.
@@ -66,10 +134,9 @@ class QuantileFilter : public Filter {
   void set_quantile(float quantile);
 
  protected:
-  std::deque<float> queue_;
+  SortedWindow window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
   float quantile_;
 };
 
@@ -95,10 +162,9 @@ class MedianFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  SortedWindow window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple min filter.
@@ -123,10 +189,9 @@ class MinFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  MonotonicWindow<std::less<float>> window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple max filter.
@@ -151,10 +216,9 @@ class MaxFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  MonotonicWindow<std::greater<float>> window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple sliding window moving average filter.
@@ -180,10 +244,9 @@ class SlidingWindowMovingAverageFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  RingBuffer<float> queue_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple exponential moving average filter.
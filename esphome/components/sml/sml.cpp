@@ -1,4 +1,5 @@
 #include "sml.h"
+#include "esphome/core/crc.h"
 #include "esphome/core/log.h"
 #include "sml_parser.h"
 
@@ -114,10 +115,9 @@ bool check_sml_data(const bytes &buffer) {
 }
 
 uint16_t calc_crc16_p1021(bytes::const_iterator begin, bytes::const_iterator end, uint16_t crcsum) {
-  for (auto it = begin; it != end; it++) {
-    crcsum = (crcsum >> 8) ^ CRC16_X25_TABLE[(crcsum & 0xff) ^ *it];
-  }
-  return crcsum;
+  if (begin == end)
+    return crcsum;
+  return crc16_ccitt_reflected_update(crcsum, &*begin, end - begin);
 }
 
 uint16_t calc_crc16_x25(bytes::const_iterator begin, bytes::const_iterator end, uint16_t crcsum = 0) {
@@ -1,4 +1,5 @@
 #include "socket.h"
+#include "esphome/core/application.h"
 #include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
 
@@ -35,13 +36,20 @@ std::string format_sockaddr(const struct sockaddr_storage &storage) {
 
 class BSDSocketImpl : public Socket {
  public:
-  BSDSocketImpl(int fd) : fd_(fd) {}
+  BSDSocketImpl(int fd) : fd_(fd) {
+#ifdef USE_LOOP_IDLE_SLEEP
+    App.register_socket_fd(fd_);
+#endif
+  }
   ~BSDSocketImpl() override {
     if (!closed_) {
       close();  // NOLINT(clang-analyzer-optin.cplusplus.VirtualCall)
     }
   }
   std::unique_ptr<Socket> accept(struct sockaddr *addr, socklen_t *addrlen) override {
+#ifdef USE_LOOP_IDLE_SLEEP
+    App.rearm_socket_fd(fd_);
+#endif
     int fd = ::accept(fd_, addr, addrlen);
     if (fd == -1)
       return {};
@@ -49,6 +57,9 @@ class BSDSocketImpl : public Socket {
   }
   int bind(const struct sockaddr *addr, socklen_t addrlen) override { return ::bind(fd_, addr, addrlen); }
   int close() override {
+#ifdef USE_LOOP_IDLE_SLEEP
+    App.unregister_socket_fd(fd_);
+#endif
     int ret = ::close(fd_);
     closed_ = true;
     return ret;
@@ -80,8 +91,16 @@ class BSDSocketImpl : public Socket {
     return ::setsockopt(fd_, level, optname, optval, optlen);
   }
   int listen(int backlog) override { return ::listen(fd_, backlog); }
-  ssize_t read(void *buf, size_t len) override { return ::read(fd_, buf, len); }
+  ssize_t read(void *buf, size_t len) override {
+#ifdef USE_LOOP_IDLE_SLEEP
+    App.rearm_socket_fd(fd_);
+#endif
+    return ::read(fd_, buf, len);
+  }
   ssize_t readv(const struct iovec *iov, int iovcnt) override {
+#ifdef USE_LOOP_IDLE_SLEEP
+    App.rearm_socket_fd(fd_);
+#endif
 #if defined(USE_ESP32) && ESP_IDF_VERSION_MAJOR < 4
     // esp-idf v3 doesn't have readv, emulate it
     ssize_t ret = 0;
@@ -119,6 +119,12 @@ struct iovec {
 #include <sys/uio.h>
 #include <unistd.h>
 
+#ifdef USE_HOST
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#endif
+
 #ifdef USE_ARDUINO
 // arduino-esp32 declares a global var called INADDR_NONE which is replaced
 // by the define
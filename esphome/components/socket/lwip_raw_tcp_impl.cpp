@@ -11,6 +11,7 @@
 #include <cstring>
 #include <queue>
 
+#include "esphome/core/application.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
@@ -492,6 +493,7 @@ class LWIPRawImpl : public Socket {
     auto sock = make_unique<LWIPRawImpl>(family_, newpcb);
     sock->init();
     accepted_sockets_.push(std::move(sock));
+    App.wake_loop_any_context();
     return ERR_OK;
   }
   void err_fn(err_t err) {
@@ -505,6 +507,8 @@ class LWIPRawImpl : public Socket {
   }
   err_t recv_fn(struct pbuf *pb, err_t err) {
     LWIP_LOG("recv(pb=%p err=%d)", pb, err);
+    // Data or a closed connection both need the attention of the socket owner
+    App.wake_loop_any_context();
     if (err != 0) {
       // "An error code if there has been an error receiving Only return ERR_ABRT if you have
       // called tcp_abort from within the callback function!"
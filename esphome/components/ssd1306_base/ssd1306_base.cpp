@@ -37,6 +37,8 @@ static const uint8_t SSD1305_COMMAND_SET_AREA_COLOR = 0xD8;
 
 void SSD1306::setup() {
   this->init_internal_(this->get_buffer_length_());
+  // one row of the buffer is a page of 8 lines
+  this->init_frame_copy_(this->get_buffer_length_(), this->get_height_internal() / 8u);
 
   // Turn off display during initialization (0xAE)
   this->command(SSD1306_COMMAND_DISPLAY_OFF);
@@ -144,6 +146,7 @@ void SSD1306::setup() {
   this->turn_on();
 }
 void SSD1306::display() {
+  this->clear_dirty_();
   if (this->is_sh1106_()) {
     this->write_display_data();
     return;
@@ -179,7 +182,9 @@ bool SSD1306::is_ssd1305_() const {
 }
 void SSD1306::update() {
   this->do_update_();
-  this->display();
+  // the buffer is small enough to always be sent as a whole, but only if something changed
+  if (this->dirty_count_ != 0)
+    this->display();
 }
 void SSD1306::set_contrast(float contrast) {
   // validation
@@ -259,16 +264,21 @@ void HOT SSD1306::draw_absolute_pixel_internal(int x, int y, Color color) {
 
   uint16_t pos = x + (y / 8) * this->get_width_internal();
   uint8_t subpos = y & 0x07;
-  if (color.is_on()) {
-    this->buffer_[pos] |= (1 << subpos);
-  } else {
-    this->buffer_[pos] &= ~(1 << subpos);
-  }
+  const uint8_t value = color.is_on() ? this->buffer_[pos] | (1 << subpos) : this->buffer_[pos] & ~(1 << subpos);
+  if (this->buffer_[pos] == value)
+    return;
+  this->buffer_[pos] = value;
+  this->mark_dirty_(x, y);
 }
 void SSD1306::fill(Color color) {
   uint8_t fill = color.is_on() ? 0xFF : 0x00;
-  for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
+  bool changed = false;
+  for (uint32_t i = 0; i < this->get_buffer_length_(); i++) {
+    changed |= this->buffer_[i] != fill;
     this->buffer_[i] = fill;
+  }
+  if (changed)
+    this->mark_all_dirty_();
 }
 void SSD1306::init_reset_() {
   if (this->reset_pin_ != nullptr) {
@@ -9,7 +9,6 @@ static const char *const TAG = "ssd1351";
 
 static const uint16_t SSD1351_COLORMASK = 0xffff;
 static const uint8_t SSD1351_MAX_CONTRAST = 15;
-static const uint8_t SSD1351_BYTESPERPIXEL = 2;
 // SSD1351 commands
 static const uint8_t SSD1351_SETCOLUMN = 0x15;
 static const uint8_t SSD1351_SETROW = 0x75;
@@ -49,6 +48,7 @@ static const uint8_t SSD1351_STARTSCROLL = 0x9F;
 
 void SSD1351::setup() {
   this->init_internal_(this->get_buffer_length_());
+  this->init_frame_copy_(this->get_buffer_length_(), this->get_height_internal());
 
   this->command(SSD1351_COMMANDLOCK);
   this->data(0x12);
@@ -85,19 +85,25 @@ void SSD1351::setup() {
   this->data(0x80);
   this->data(0xC8);
   set_brightness(this->brightness_);
+  this->mark_all_dirty_();
   this->fill(Color::BLACK);  // clear display - ensures we do not see garbage at power-on
   this->display();           // ...write buffer, which actually clears the display's memory
   this->turn_on();           // display ON
 }
 void SSD1351::display() {
-  this->command(SSD1351_SETCOLUMN);  // set column address
-  this->data(0x00);                  // set column start address
-  this->data(0x7F);                  // set column end address
-  this->command(SSD1351_SETROW);     // set row address
-  this->data(0x00);                  // set row start address
-  this->data(0x7F);                  // set last row
-  this->command(SSD1351_WRITERAM);
-  this->write_display_data();
+  // only the regions that changed since the last update are sent
+  for (uint8_t i = 0; i < this->dirty_count_; i++) {
+    const display::DirtyRect &rect = this->dirty_rects_[i];
+    this->command(SSD1351_SETCOLUMN);  // set column address
+    this->data(rect.x1);               // set column start address
+    this->data(rect.x2 - 1);           // set column end address
+    this->command(SSD1351_SETROW);     // set row address
+    this->data(rect.y1);               // set row start address
+    this->data(rect.y2 - 1);           // set last row
+    this->command(SSD1351_WRITERAM);
+    this->write_display_data(rect);
+  }
+  this->clear_dirty_();
 }
 void SSD1351::update() {
   this->do_update_();
@@ -153,18 +159,17 @@ void HOT SSD1351::draw_absolute_pixel_internal(int x, int y, Color color) {
   const uint32_t color565 = display::ColorUtil::color_to_565(color);
   // where should the bits go in the big buffer array? math...
   uint16_t pos = (x + y * this->get_width_internal()) * SSD1351_BYTESPERPIXEL;
-  this->buffer_[pos++] = (color565 >> 8) & 0xff;
-  this->buffer_[pos] = color565 & 0xff;
+  const uint8_t high = (color565 >> 8) & 0xff, low = color565 & 0xff;
+  if (this->buffer_[pos] == high && this->buffer_[pos + 1] == low)
+    return;
+  this->buffer_[pos++] = high;
+  this->buffer_[pos] = low;
+  this->mark_dirty_(x, y);
 }
 void SSD1351::fill(Color color) {
   const uint32_t color565 = display::ColorUtil::color_to_565(color);
-  for (uint32_t i = 0; i < this->get_buffer_length_(); i++) {
-    if (i & 1) {
-      this->buffer_[i] = color565 & 0xff;
-    } else {
-      this->buffer_[i] = (color565 >> 8) & 0xff;
-    }
-  }
+  const uint8_t pixel[SSD1351_BYTESPERPIXEL] = {uint8_t((color565 >> 8) & 0xff), uint8_t(color565 & 0xff)};
+  this->fill_buffer_(pixel, SSD1351_BYTESPERPIXEL);
 }
 void SSD1351::init_reset_() {
   if (this->reset_pin_ != nullptr) {
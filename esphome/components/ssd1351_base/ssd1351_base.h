@@ -7,6 +7,8 @@
 namespace esphome {
 namespace ssd1351_base {
 
+static const uint8_t SSD1351_BYTESPERPIXEL = 2;
+
 enum SSD1351Model {
   SSD1351_MODEL_128_96 = 0,
   SSD1351_MODEL_128_128,
@@ -36,7 +38,8 @@ class SSD1351 : public PollingComponent, public display::DisplayBuffer {
  protected:
   virtual void command(uint8_t value) = 0;
   virtual void data(uint8_t value) = 0;
-  virtual void write_display_data() = 0;
+  /// Write the pixels of a region after its address window was set.
+  virtual void write_display_data(const display::DirtyRect &rect) = 0;
   void init_reset_();
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
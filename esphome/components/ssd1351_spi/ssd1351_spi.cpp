@@ -54,7 +54,7 @@ void SPISSD1351::data(uint8_t value) {
     this->cs_->digital_write(true);
   this->disable();
 }
-void HOT SPISSD1351::write_display_data() {
+void HOT SPISSD1351::write_display_data(const display::DirtyRect &rect) {
   if (this->cs_)
     this->cs_->digital_write(true);
   this->dc_pin_->digital_write(true);
@@ -62,7 +62,10 @@ void HOT SPISSD1351::write_display_data() {
     this->cs_->digital_write(false);
   delay(1);
   this->enable();
-  this->write_array(this->buffer_, this->get_buffer_length_());
+  const int row_bytes = this->get_width_internal() * ssd1351_base::SSD1351_BYTESPERPIXEL;
+  for (int y = rect.y1; y < rect.y2; y++)
+    this->write_array(this->buffer_ + y * row_bytes + rect.x1 * ssd1351_base::SSD1351_BYTESPERPIXEL,
+                      rect.width() * ssd1351_base::SSD1351_BYTESPERPIXEL);
   if (this->cs_)
     this->cs_->digital_write(true);
   this->disable();
@@ -289,6 +289,9 @@ void ST7735::setup() {
 
   this->init_internal_(this->get_buffer_length());
   memset(this->buffer_, 0x00, this->get_buffer_length());
+  // the first update sends the whole buffer
+  this->mark_all_dirty_();
+  this->init_frame_copy_(this->get_buffer_length(), this->get_height_internal());
 }
 
 void ST7735::update() {
@@ -314,13 +317,19 @@ void HOT ST7735::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (this->eightbitcolor_) {
     const uint32_t color332 = display::ColorUtil::color_to_332(color);
     uint16_t pos = (x + y * this->get_width_internal());
+    if (this->buffer_[pos] == color332)
+      return;
     this->buffer_[pos] = color332;
   } else {
     const uint32_t color565 = display::ColorUtil::color_to_565(color);
     uint16_t pos = (x + y * this->get_width_internal()) * 2;
-    this->buffer_[pos++] = (color565 >> 8) & 0xff;
-    this->buffer_[pos] = color565 & 0xff;
+    const uint8_t high = (color565 >> 8) & 0xff, low = color565 & 0xff;
+    if (this->buffer_[pos] == high && this->buffer_[pos + 1] == low)
+      return;
+    this->buffer_[pos++] = high;
+    this->buffer_[pos] = low;
   }
+  this->mark_dirty_(x, y);
 }
 
 void ST7735::init_reset_() {
@@ -418,13 +427,19 @@ void HOT ST7735::senddata_(const uint8_t *data_bytes, uint8_t num_data_bytes) {
 }
 
 void HOT ST7735::write_display_data_() {
+  for (uint8_t i = 0; i < this->dirty_count_; i++)
+    this->write_display_data_(this->dirty_rects_[i]);
+  this->clear_dirty_();
+}
+
+void HOT ST7735::write_display_data_(const display::DirtyRect &rect) {
   uint16_t offsetx = colstart_;
   uint16_t offsety = rowstart_;
 
-  uint16_t x1 = offsetx;
-  uint16_t x2 = x1 + get_width_internal() - 1;
-  uint16_t y1 = offsety;
-  uint16_t y2 = y1 + get_height_internal() - 1;
+  uint16_t x1 = offsetx + rect.x1;
+  uint16_t x2 = offsetx + rect.x2 - 1;
+  uint16_t y1 = offsety + rect.y1;
+  uint16_t y2 = offsety + rect.y2 - 1;
 
   this->enable();
 
@@ -445,9 +460,10 @@ void HOT ST7735::write_display_data_() {
   this->write_byte(ST77XX_RAMWR);
   this->dc_pin_->digital_write(true);
 
+  const int width = this->get_width_internal();
   if (this->eightbitcolor_) {
-    for (size_t line = 0; line < this->get_buffer_length(); line = line + this->get_width_internal()) {
-      for (int index = 0; index < this->get_width_internal(); ++index) {
+    for (int line = rect.y1 * width; line < rect.y2 * width; line = line + width) {
+      for (int index = rect.x1; index < rect.x2; ++index) {
         auto color332 = display::ColorUtil::to_color(this->buffer_[index + line], display::ColorOrder::COLOR_ORDER_RGB,
                                                      display::ColorBitness::COLOR_BITNESS_332, true);
 
@@ -457,8 +473,11 @@ void HOT ST7735::write_display_data_() {
         this->write_byte(color & 0xff);
       }
     }
+  } else if (rect.width() == width) {
+    this->write_array(this->buffer_ + rect.y1 * width * 2, rect.area() * 2);
   } else {
-    this->write_array(this->buffer_, this->get_buffer_length());
+    for (int line = rect.y1; line < rect.y2; line++)
+      this->write_array(this->buffer_ + (line * width + rect.x1) * 2, rect.width() * 2);
   }
   this->disable();
 }
@@ -63,6 +63,7 @@ class ST7735 : public PollingComponent,
   void writedata_(uint8_t value);
 
   void write_display_data_();
+  void write_display_data_(const display::DirtyRect &rect);
 
   void init_reset_();
   void display_init_(const uint8_t *addr);
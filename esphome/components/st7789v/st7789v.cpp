@@ -113,6 +113,9 @@ void ST7789V::setup() {
 
   this->init_internal_(this->get_buffer_length_());
   memset(this->buffer_, 0x00, this->get_buffer_length_());
+  // the display was cleared above, buffer and display match
+  this->clear_dirty_();
+  this->init_frame_copy_(this->get_buffer_length_(), this->get_height_internal());
 }
 
 void ST7789V::dump_config() {
@@ -168,10 +171,17 @@ void ST7789V::set_model(ST7789VModel model) {
 }
 
 void ST7789V::write_display_data() {
-  uint16_t x1 = this->offset_height_;
-  uint16_t x2 = x1 + get_width_internal() - 1;
-  uint16_t y1 = this->offset_width_;
-  uint16_t y2 = y1 + get_height_internal() - 1;
+  // only the regions that changed since the last update are sent
+  for (uint8_t i = 0; i < this->dirty_count_; i++)
+    this->write_display_data_(this->dirty_rects_[i]);
+  this->clear_dirty_();
+}
+
+void ST7789V::write_display_data_(const display::DirtyRect &rect) {
+  uint16_t x1 = this->offset_height_ + rect.x1;
+  uint16_t x2 = this->offset_height_ + rect.x2 - 1;
+  uint16_t y1 = this->offset_width_ + rect.y1;
+  uint16_t y2 = this->offset_width_ + rect.y2 - 1;
 
   this->enable();
 
@@ -190,9 +200,10 @@ void ST7789V::write_display_data() {
   this->write_byte(ST7789_RAMWR);
   this->dc_pin_->digital_write(true);
 
+  const int width = this->get_width_internal();
   if (this->eightbitcolor_) {
-    for (int line = 0; line < this->get_buffer_length_(); line = line + this->get_width_internal()) {
-      for (int index = 0; index < this->get_width_internal(); ++index) {
+    for (int line = rect.y1 * width; line < rect.y2 * width; line = line + width) {
+      for (int index = rect.x1; index < rect.x2; ++index) {
         auto color = display::ColorUtil::color_to_565(
             display::ColorUtil::to_color(this->buffer_[index + line], display::ColorOrder::COLOR_ORDER_RGB,
                                          display::ColorBitness::COLOR_BITNESS_332, true));
@@ -200,8 +211,12 @@ void ST7789V::write_display_data() {
         this->write_byte(color & 0xff);
       }
     }
+  } else if (rect.width() == width) {
+    // full rows are contiguous in the buffer
+    this->write_array(this->buffer_ + rect.y1 * width * 2, rect.area() * 2);
   } else {
-    this->write_array(this->buffer_, this->get_buffer_length_());
+    for (int line = rect.y1; line < rect.y2; line++)
+      this->write_array(this->buffer_ + (line * width + rect.x1) * 2, rect.width() * 2);
   }
 
   this->disable();
@@ -306,13 +321,20 @@ void HOT ST7789V::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (this->eightbitcolor_) {
     auto color332 = display::ColorUtil::color_to_332(color);
     uint32_t pos = (x + y * this->get_width_internal());
+    if (this->buffer_[pos] == color332)
+      return;
     this->buffer_[pos] = color332;
   } else {
     auto color565 = display::ColorUtil::color_to_565(color);
     uint32_t pos = (x + y * this->get_width_internal()) * 2;
-    this->buffer_[pos++] = (color565 >> 8) & 0xff;
-    this->buffer_[pos] = color565 & 0xff;
+    const uint8_t high = (color565 >> 8) & 0xff, low = color565 & 0xff;
+    if (this->buffer_[pos] == high && this->buffer_[pos + 1] == low)
+      return;
+    this->buffer_[pos++] = high;
+    this->buffer_[pos] = low;
   }
+  // only changed pixels are sent to the display
+  this->mark_dirty_(x, y);
 }
 
 const char *ST7789V::model_str_() {
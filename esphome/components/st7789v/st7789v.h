@@ -162,6 +162,7 @@ class ST7789V : public PollingComponent,
   size_t get_buffer_length_();
 
   void draw_filled_rect_(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);
+  void write_display_data_(const display::DirtyRect &rect);
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
 
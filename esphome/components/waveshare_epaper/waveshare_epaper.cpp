@@ -84,6 +84,10 @@ static const uint8_t PARTIAL_UPDATE_LUT_TTGO_B1[LUT_SIZE_TTGO_B1] = {
 
 void WaveshareEPaper::setup_pins_() {
   this->init_internal_(this->get_buffer_length_());
+  // only used to tell whether anything changed, the panel is always refreshed as a whole
+  this->init_frame_copy_(this->get_buffer_length_(), 1);
+  // the first update always refreshes the panel
+  this->mark_all_dirty_();
   this->dc_pin_->setup();  // OUTPUT
   this->dc_pin_->digital_write(false);
   if (this->reset_pin_ != nullptr) {
@@ -125,13 +129,22 @@ bool WaveshareEPaper::wait_until_idle_() {
 }
 void WaveshareEPaper::update() {
   this->do_update_();
+  // a refresh takes seconds and makes the panel flicker, skip it if the content didn't change
+  if (this->dirty_count_ == 0)
+    return;
+  this->clear_dirty_();
   this->display();
 }
 void WaveshareEPaper::fill(Color color) {
   // flip logic
   const uint8_t fill = color.is_on() ? 0x00 : 0xFF;
-  for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
+  bool changed = false;
+  for (uint32_t i = 0; i < this->get_buffer_length_(); i++) {
+    changed |= this->buffer_[i] != fill;
     this->buffer_[i] = fill;
+  }
+  if (changed)
+    this->mark_all_dirty_();
 }
 void HOT WaveshareEPaper::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (x >= this->get_width_internal() || y >= this->get_height_internal() || x < 0 || y < 0)
@@ -140,11 +153,11 @@ void HOT WaveshareEPaper::draw_absolute_pixel_internal(int x, int y, Color color
   const uint32_t pos = (x + y * this->get_width_internal()) / 8u;
   const uint8_t subpos = x & 0x07;
   // flip logic
-  if (!color.is_on()) {
-    this->buffer_[pos] |= 0x80 >> subpos;
-  } else {
-    this->buffer_[pos] &= ~(0x80 >> subpos);
-  }
+  const uint8_t value = color.is_on() ? this->buffer_[pos] & ~(0x80 >> subpos) : this->buffer_[pos] | (0x80 >> subpos);
+  if (this->buffer_[pos] == value)
+    return;
+  this->buffer_[pos] = value;
+  this->mark_dirty_(x, y);
 }
 uint32_t WaveshareEPaper::get_buffer_length_() { return this->get_width_internal() * this->get_height_internal() / 8u; }
 void WaveshareEPaper::start_command_() {
@@ -6,7 +6,7 @@
 #include "esphome/core/application.h"
 #include "esphome/core/entity_base.h"
 #include "esphome/core/util.h"
-#include "esphome/components/json/json_util.h"
+#include "esphome/components/json/json_writer.h"
 #include "esphome/components/network/util.h"
 
 #include "StreamString.h"
@@ -96,10 +96,10 @@ void WebServer::setup() {
   this->events_.onConnect([this](AsyncEventSourceClient *client) {
     // Configure reconnect timeout and send config
 
-    client->send(json::build_json([this](JsonObject root) {
-                   root["title"] = App.get_name();
-                   root["ota"] = this->allow_ota_;
-                   root["lang"] = "en";
+    client->send(json::write_json([this](json::JsonWriter &json) {
+                   json.add("title", App.get_name());
+                   json.add("ota", this->allow_ota_);
+                   json.add("lang", "en");
                  }).c_str(),
                  "ping", millis(), 30000);
 
@@ -328,21 +328,33 @@ void WebServer::handle_js_request(AsyncWebServerRequest *request) {
 }
 #endif
 
-#define set_json_id(root, obj, sensor, start_config) \
-  (root)["id"] = sensor; \
-  if (((start_config) == DETAIL_ALL)) \
-    (root)["name"] = (obj)->get_name();
+static void set_json_id(json::JsonWriter &json, EntityBase *obj, const char *prefix, JsonDetail start_config) {
+  json.key("id").value(prefix, obj->get_object_id());
+  if (start_config == DETAIL_ALL)
+    json.add("name", obj->get_name());
+}
 
-#define set_json_value(root, obj, sensor, value, start_config) \
-  set_json_id((root), (obj), sensor, start_config)(root)["value"] = value;
+template<typename V>
+static void set_json_value(json::JsonWriter &json, EntityBase *obj, const char *prefix, V &&value,
+                           JsonDetail start_config) {
+  set_json_id(json, obj, prefix, start_config);
+  json.add("value", std::forward<V>(value));
+}
 
-#define set_json_state_value(root, obj, sensor, state, value, start_config) \
-  set_json_value(root, obj, sensor, value, start_config)(root)["state"] = state;
+template<typename S, typename V>
+static void set_json_state_value(json::JsonWriter &json, EntityBase *obj, const char *prefix, S &&state, V &&value,
+                                 JsonDetail start_config) {
+  set_json_value(json, obj, prefix, std::forward<V>(value), start_config);
+  json.add("state", std::forward<S>(state));
+}
 
-#define set_json_icon_state_value(root, obj, sensor, state, value, start_config) \
-  set_json_value(root, obj, sensor, value, start_config)(root)["state"] = state; \
-  if (((start_config) == DETAIL_ALL)) \
-    (root)["icon"] = (obj)->get_icon();
+template<typename S, typename V>
+static void set_json_icon_state_value(json::JsonWriter &json, EntityBase *obj, const char *prefix, S &&state,
+                                      V &&value, JsonDetail start_config) {
+  set_json_state_value(json, obj, prefix, std::forward<S>(state), std::forward<V>(value), start_config);
+  if (start_config == DETAIL_ALL)
+    json.add("icon", obj->get_icon());
+}
 
 #ifdef USE_SENSOR
 void WebServer::on_sensor_update(sensor::Sensor *obj, float state) {
@@ -359,11 +371,11 @@ void WebServer::handle_sensor_request(AsyncWebServerRequest *request, const UrlM
   request->send(404);
 }
 std::string WebServer::sensor_json(sensor::Sensor *obj, float value, JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
+  return json::write_json([obj, value, start_config](json::JsonWriter &json) {
     std::string state = value_accuracy_to_string(value, obj->get_accuracy_decimals());
     if (!obj->get_unit_of_measurement().empty())
       state += " " + obj->get_unit_of_measurement();
-    set_json_icon_state_value(root, obj, "sensor-" + obj->get_object_id(), state, value, start_config);
+    set_json_icon_state_value(json, obj, "sensor-", state, value, start_config);
   });
 }
 #endif
@@ -384,8 +396,8 @@ void WebServer::handle_text_sensor_request(AsyncWebServerRequest *request, const
 }
 std::string WebServer::text_sensor_json(text_sensor::TextSensor *obj, const std::string &value,
                                         JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "text_sensor-" + obj->get_object_id(), value, value, start_config);
+  return json::write_json([obj, &value, start_config](json::JsonWriter &json) {
+    set_json_icon_state_value(json, obj, "text_sensor-", value, value, start_config);
   });
 }
 #endif
@@ -395,8 +407,8 @@ void WebServer::on_switch_update(switch_::Switch *obj, bool state) {
   this->events_.send(this->switch_json(obj, state, DETAIL_STATE).c_str(), "state");
 }
 std::string WebServer::switch_json(switch_::Switch *obj, bool value, JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "switch-" + obj->get_object_id(), value ? "ON" : "OFF", value, start_config);
+  return json::write_json([obj, value, start_config](json::JsonWriter &json) {
+    set_json_icon_state_value(json, obj, "switch-", value ? "ON" : "OFF", value, start_config);
   });
 }
 void WebServer::handle_switch_request(AsyncWebServerRequest *request, const UrlMatch &match) {
@@ -427,8 +439,8 @@ void WebServer::handle_switch_request(AsyncWebServerRequest *request, const UrlM
 
 #ifdef USE_BUTTON
 std::string WebServer::button_json(button::Button *obj, JsonDetail start_config) {
-  return json::build_json(
-      [obj, start_config](JsonObject root) { set_json_id(root, obj, "button-" + obj->get_object_id(), start_config); });
+  return json::write_json(
+      [obj, start_config](json::JsonWriter &json) { set_json_id(json, obj, "button-", start_config); });
 }
 
 void WebServer::handle_button_request(AsyncWebServerRequest *request, const UrlMatch &match) {
@@ -453,8 +465,8 @@ void WebServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool s
   this->events_.send(this->binary_sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
 }
 std::string WebServer::binary_sensor_json(binary_sensor::BinarySensor *obj, bool value, JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
-    set_json_state_value(root, obj, "binary_sensor-" + obj->get_object_id(), value ? "ON" : "OFF", value, start_config);
+  return json::write_json([obj, value, start_config](json::JsonWriter &json) {
+    set_json_state_value(json, obj, "binary_sensor-", value ? "ON" : "OFF", value, start_config);
   });
 }
 void WebServer::handle_binary_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
@@ -472,15 +484,15 @@ void WebServer::handle_binary_sensor_request(AsyncWebServerRequest *request, con
 #ifdef USE_FAN
 void WebServer::on_fan_update(fan::Fan *obj) { this->events_.send(this->fan_json(obj, DETAIL_STATE).c_str(), "state"); }
 std::string WebServer::fan_json(fan::Fan *obj, JsonDetail start_config) {
-  return json::build_json([obj, start_config](JsonObject root) {
-    set_json_state_value(root, obj, "fan-" + obj->get_object_id(), obj->state ? "ON" : "OFF", obj->state, start_config);
+  return json::write_json([obj, start_config](json::JsonWriter &json) {
+    set_json_state_value(json, obj, "fan-", obj->state ? "ON" : "OFF", obj->state, start_config);
     const auto traits = obj->get_traits();
     if (traits.supports_speed()) {
-      root["speed_level"] = obj->speed;
-      root["speed_count"] = traits.supported_speed_count();
+      json.add("speed_level", obj->speed);
+      json.add("speed_count", traits.supported_speed_count());
     }
     if (obj->get_traits().supports_oscillation())
-      root["oscillation"] = obj->oscillating;
+      json.add("oscillation", obj->oscillating);
   });
 }
 void WebServer::handle_fan_request(AsyncWebServerRequest *request, const UrlMatch &match) {
@@ -603,19 +615,24 @@ void WebServer::handle_light_request(AsyncWebServerRequest *request, const UrlMa
   request->send(404);
 }
 std::string WebServer::light_json(light::LightState *obj, JsonDetail start_config) {
-  return json::build_json([obj, start_config](JsonObject root) {
-    set_json_id(root, obj, "light-" + obj->get_object_id(), start_config);
-    root["state"] = obj->remote_values.is_on() ? "ON" : "OFF";
-
-    light::LightJSONSchema::dump_json(*obj, root);
-    if (start_config == DETAIL_ALL) {
-      JsonArray opt = root.createNestedArray("effects");
-      opt.add("None");
-      for (auto const &option : obj->get_effects()) {
-        opt.add(option->get_name());
-      }
-    }
-  });
+  return json::write_json(
+      [obj, start_config](json::JsonWriter &json) {
+        set_json_id(json, obj, "light-", start_config);
+        // dump_json() only writes the state of lights that support on/off
+        if (!(obj->remote_values.get_color_mode() & light::ColorCapability::ON_OFF))
+          json.add("state", obj->remote_values.is_on() ? "ON" : "OFF");
+
+        light::LightJSONSchema::dump_json(*obj, json);
+        if (start_config == DETAIL_ALL) {
+          json.begin_array("effects");
+          json.value("None");
+          for (auto const &option : obj->get_effects()) {
+            json.value(option->get_name());
+          }
+          json.end_array();
+        }
+      },
+      256);
 }
 #endif
 
@@ -665,13 +682,13 @@ void WebServer::handle_cover_request(AsyncWebServerRequest *request, const UrlMa
   request->send(404);
 }
 std::string WebServer::cover_json(cover::Cover *obj, JsonDetail start_config) {
-  return json::build_json([obj, start_config](JsonObject root) {
-    set_json_state_value(root, obj, "cover-" + obj->get_object_id(), obj->is_fully_closed() ? "CLOSED" : "OPEN",
-                         obj->position, start_config);
-    root["current_operation"] = cover::cover_operation_to_str(obj->current_operation);
+  return json::write_json([obj, start_config](json::JsonWriter &json) {
+    set_json_state_value(json, obj, "cover-", obj->is_fully_closed() ? "CLOSED" : "OPEN", obj->position,
+                         start_config);
+    json.add("current_operation", cover::cover_operation_to_str(obj->current_operation));
 
     if (obj->get_traits().get_supports_tilt())
-      root["tilt"] = obj->tilt;
+      json.add("tilt", obj->tilt);
   });
 }
 #endif
@@ -711,20 +728,21 @@ void WebServer::handle_number_request(AsyncWebServerRequest *request, const UrlM
 }
 
 std::string WebServer::number_json(number::Number *obj, float value, JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
-    set_json_id(root, obj, "number-" + obj->get_object_id(), start_config);
+  return json::write_json([obj, value, start_config](json::JsonWriter &json) {
+    set_json_id(json, obj, "number-", start_config);
     if (start_config == DETAIL_ALL) {
-      root["min_value"] = obj->traits.get_min_value();
-      root["max_value"] = obj->traits.get_max_value();
-      root["step"] = obj->traits.get_step();
-      root["mode"] = (int) obj->traits.get_mode();
+      json.add("min_value", obj->traits.get_min_value());
+      json.add("max_value", obj->traits.get_max_value());
+      json.add("step", obj->traits.get_step());
+      json.add("mode", (int) obj->traits.get_mode());
     }
-    std::string state = str_sprintf("%f", value);
-    root["state"] = state;
+    char state[32];
+    snprintf(state, sizeof(state), "%f", value);
+    json.add("state", state);
     if (isnan(value)) {
-      root["value"] = "\"NaN\"";
+      json.add("value", "\"NaN\"");
     } else {
-      root["value"] = value;
+      json.add("value", value);
     }
   });
 }
@@ -764,13 +782,14 @@ void WebServer::handle_select_request(AsyncWebServerRequest *request, const UrlM
   request->send(404);
 }
 std::string WebServer::select_json(select::Select *obj, const std::string &value, JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
-    set_json_state_value(root, obj, "select-" + obj->get_object_id(), value, value, start_config);
+  return json::write_json([obj, &value, start_config](json::JsonWriter &json) {
+    set_json_state_value(json, obj, "select-", value, value, start_config);
     if (start_config == DETAIL_ALL) {
-      JsonArray opt = root.createNestedArray("option");
+      json.begin_array("option");
       for (auto &option : obj->traits.get_options()) {
-        opt.add(option);
+        json.value(option);
       }
+      json.end_array();
     }
   });
 }
@@ -836,76 +855,84 @@ void WebServer::handle_climate_request(AsyncWebServerRequest *request, const Url
 #define PSTR_LOCAL(mode_s) strncpy_P(__buf, (PGM_P)((mode_s)), 15)
 
 std::string WebServer::climate_json(climate::Climate *obj, JsonDetail start_config) {
-  return json::build_json([obj, start_config](JsonObject root) {
-    set_json_id(root, obj, "climate-" + obj->get_object_id(), start_config);
-    const auto traits = obj->get_traits();
-    char __buf[16];
-
-    if (start_config == DETAIL_ALL) {
-      JsonArray opt = root.createNestedArray("modes");
-      for (climate::ClimateMode m : traits.get_supported_modes())
-        opt.add(PSTR_LOCAL(climate::climate_mode_to_string(m)));
-      if (!traits.get_supported_custom_fan_modes().empty()) {
-        JsonArray opt = root.createNestedArray("fan_modes");
-        for (climate::ClimateFanMode m : traits.get_supported_fan_modes())
-          opt.add(PSTR_LOCAL(climate::climate_fan_mode_to_string(m)));
-      }
-
-      if (!traits.get_supported_custom_fan_modes().empty()) {
-        JsonArray opt = root.createNestedArray("custom_fan_modes");
-        for (auto const &custom_fan_mode : traits.get_supported_custom_fan_modes())
-          opt.add(custom_fan_mode);
-      }
-      if (traits.get_supports_swing_modes()) {
-        JsonArray opt = root.createNestedArray("swing_modes");
-        for (auto swing_mode : traits.get_supported_swing_modes())
-          opt.add(PSTR_LOCAL(climate::climate_swing_mode_to_string(swing_mode)));
-      }
-      if (traits.get_supports_presets() && obj->preset.has_value()) {
-        JsonArray opt = root.createNestedArray("presets");
-        for (climate::ClimatePreset m : traits.get_supported_presets())
-          opt.add(PSTR_LOCAL(climate::climate_preset_to_string(m)));
-      }
-      if (!traits.get_supported_custom_presets().empty() && obj->custom_preset.has_value()) {
-        JsonArray opt = root.createNestedArray("custom_presets");
-        for (auto const &custom_preset : traits.get_supported_custom_presets())
-          opt.add(custom_preset);
-      }
-    }
+  return json::write_json(
+      [obj, start_config](json::JsonWriter &json) {
+        set_json_id(json, obj, "climate-", start_config);
+        const auto traits = obj->get_traits();
+        char __buf[16];
+
+        if (start_config == DETAIL_ALL) {
+          json.begin_array("modes");
+          for (climate::ClimateMode m : traits.get_supported_modes())
+            json.value(PSTR_LOCAL(climate::climate_mode_to_string(m)));
+          json.end_array();
+          if (!traits.get_supported_custom_fan_modes().empty()) {
+            json.begin_array("fan_modes");
+            for (climate::ClimateFanMode m : traits.get_supported_fan_modes())
+              json.value(PSTR_LOCAL(climate::climate_fan_mode_to_string(m)));
+            json.end_array();
+          }
+
+          if (!traits.get_supported_custom_fan_modes().empty()) {
+            json.begin_array("custom_fan_modes");
+            for (auto const &custom_fan_mode : traits.get_supported_custom_fan_modes())
+              json.value(custom_fan_mode);
+            json.end_array();
+          }
+          if (traits.get_supports_swing_modes()) {
+            json.begin_array("swing_modes");
+            for (auto swing_mode : traits.get_supported_swing_modes())
+              json.value(PSTR_LOCAL(climate::climate_swing_mode_to_string(swing_mode)));
+            json.end_array();
+          }
+          if (traits.get_supports_presets() && obj->preset.has_value()) {
+            json.begin_array("presets");
+            for (climate::ClimatePreset m : traits.get_supported_presets())
+              json.value(PSTR_LOCAL(climate::climate_preset_to_string(m)));
+            json.end_array();
+          }
+          if (!traits.get_supported_custom_presets().empty() && obj->custom_preset.has_value()) {
+            json.begin_array("custom_presets");
+            for (auto const &custom_preset : traits.get_supported_custom_presets())
+              json.value(custom_preset);
+            json.end_array();
+          }
+        }
 
-    root["mode"] = PSTR_LOCAL(climate_mode_to_string(obj->mode));
-    root["max_temp"] = traits.get_visual_max_temperature();
-    root["min_temp"] = traits.get_visual_min_temperature();
-    root["step"] = traits.get_visual_temperature_step();
-    if (traits.get_supports_action()) {
-      root["action"] = PSTR_LOCAL(climate_action_to_string(obj->action));
-    }
-    if (traits.get_supports_fan_modes() && obj->fan_mode.has_value()) {
-      root["fan_mode"] = PSTR_LOCAL(climate_fan_mode_to_string(obj->fan_mode.value()));
-    }
-    if (!traits.get_supported_custom_fan_modes().empty() && obj->custom_fan_mode.has_value()) {
-      root["custom_fan_mode"] = obj->custom_fan_mode.value().c_str();
-    }
-    if (traits.get_supports_presets() && obj->preset.has_value()) {
-      root["preset"] = PSTR_LOCAL(climate_preset_to_string(obj->preset.value()));
-    }
-    if (!traits.get_supported_custom_presets().empty() && obj->custom_preset.has_value()) {
-      root["custom_preset"] = obj->custom_preset.value().c_str();
-    }
-    if (traits.get_supports_swing_modes()) {
-      root["swing_mode"] = PSTR_LOCAL(climate_swing_mode_to_string(obj->swing_mode));
-    }
-    if (traits.get_supports_current_temperature()) {
-      root["current_temperature"] = obj->current_temperature;
-    }
-    if (traits.get_supports_two_point_target_temperature()) {
-      root["current_temperature_low"] = obj->target_temperature_low;
-      root["current_temperature_high"] = obj->target_temperature_low;
-    } else {
-      root["target_temperature"] = obj->target_temperature;
-      root["state"] = obj->target_temperature;
-    }
-  });
+        json.add("mode", PSTR_LOCAL(climate_mode_to_string(obj->mode)));
+        json.add("max_temp", traits.get_visual_max_temperature());
+        json.add("min_temp", traits.get_visual_min_temperature());
+        json.add("step", traits.get_visual_temperature_step());
+        if (traits.get_supports_action()) {
+          json.add("action", PSTR_LOCAL(climate_action_to_string(obj->action)));
+        }
+        if (traits.get_supports_fan_modes() && obj->fan_mode.has_value()) {
+          json.add("fan_mode", PSTR_LOCAL(climate_fan_mode_to_string(obj->fan_mode.value())));
+        }
+        if (!traits.get_supported_custom_fan_modes().empty() && obj->custom_fan_mode.has_value()) {
+          json.add("custom_fan_mode", obj->custom_fan_mode.value());
+        }
+        if (traits.get_supports_presets() && obj->preset.has_value()) {
+          json.add("preset", PSTR_LOCAL(climate_preset_to_string(obj->preset.value())));
+        }
+        if (!traits.get_supported_custom_presets().empty() && obj->custom_preset.has_value()) {
+          json.add("custom_preset", obj->custom_preset.value());
+        }
+        if (traits.get_supports_swing_modes()) {
+          json.add("swing_mode", PSTR_LOCAL(climate_swing_mode_to_string(obj->swing_mode)));
+        }
+        if (traits.get_supports_current_temperature()) {
+          json.add("current_temperature", obj->current_temperature);
+        }
+        if (traits.get_supports_two_point_target_temperature()) {
+          json.add("current_temperature_low", obj->target_temperature_low);
+          json.add("current_temperature_high", obj->target_temperature_low);
+        } else {
+          json.add("target_temperature", obj->target_temperature);
+          json.add("state", obj->target_temperature);
+        }
+      },
+      384);
 }
 #endif
 
@@ -914,9 +941,8 @@ void WebServer::on_lock_update(lock::Lock *obj) {
   this->events_.send(this->lock_json(obj, obj->state, DETAIL_STATE).c_str(), "state");
 }
 std::string WebServer::lock_json(lock::Lock *obj, lock::LockState value, JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "lock-" + obj->get_object_id(), lock::lock_state_to_string(value), value,
-                              start_config);
+  return json::write_json([obj, value, start_config](json::JsonWriter &json) {
+    set_json_icon_state_value(json, obj, "lock-", lock::lock_state_to_string(value), (int) value, start_config);
   });
 }
 void WebServer::handle_lock_request(AsyncWebServerRequest *request, const UrlMatch &match) {
@@ -5,6 +5,8 @@
 
 #ifdef USE_ESP32
 
+#include "xiaomi_cipher.h"
+
 namespace esphome {
 namespace xiaomi_ble {
 
@@ -64,8 +66,9 @@ struct XiaomiAESVector {
 };
 
 bool parse_xiaomi_value(uint16_t value_type, const uint8_t *data, uint8_t value_length, XiaomiParseResult &result);
-bool parse_xiaomi_message(const std::vector<uint8_t> &message, XiaomiParseResult &result);
+bool parse_xiaomi_message(const esp32_ble_tracker::AdvDataView &message, XiaomiParseResult &result);
 optional<XiaomiParseResult> parse_xiaomi_header(const esp32_ble_tracker::ServiceData &service_data);
+/// Decrypt a payload in place. Sets up a new cipher on every call, sensors with a fixed bindkey use XiaomiCipher.
 bool decrypt_xiaomi_payload(std::vector<uint8_t> &raw, const uint8_t *bindkey, const uint64_t &address);
 bool report_xiaomi_results(const optional<XiaomiParseResult> &result, const std::string &address);
 
@@ -0,0 +1,79 @@
+#include "xiaomi_cipher.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#if defined(USE_ESP32) || defined(USE_HOST)
+
+#include <cstring>
+
+namespace esphome {
+namespace xiaomi_ble {
+
+static const char *const TAG = "xiaomi_ble";
+
+bool XiaomiCipher::set_key(const uint8_t *bindkey) {
+  memcpy(this->key_, bindkey, sizeof(this->key_));
+  this->has_key_ = mbedtls_ccm_setkey(&this->ctx_, MBEDTLS_CIPHER_ID_AES, this->key_, sizeof(this->key_) * 8) == 0;
+  if (!this->has_key_) {
+    ESP_LOGVV(TAG, "XiaomiCipher::set_key(): mbedtls_ccm_setkey() failed.");
+  }
+  return this->has_key_;
+}
+
+bool XiaomiCipher::decrypt(const uint8_t *raw, size_t size, uint8_t *out, const uint64_t &address) {
+  if (size > MAX_PAYLOAD_SIZE) {
+    ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): data packet has wrong size (%d)!", size);
+    return false;
+  }
+  memcpy(out, raw, size);
+  return this->decrypt(out, size, address);
+}
+
+bool XiaomiCipher::decrypt(uint8_t *raw, size_t size, const uint64_t &address) {
+  if (!((size == 19) || ((size >= 22) && (size <= 24)))) {
+    ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): data packet has wrong size (%d)!", size);
+    ESP_LOGVV(TAG, "  Packet : %s", format_hex_pretty(raw, size).c_str());
+    return false;
+  }
+  if (!this->has_key_)
+    return false;
+
+  static const uint8_t AUTHDATA[1] = {0x11};
+  static const size_t TAG_SIZE = 4;
+  static const size_t IV_SIZE = 12;
+
+  const size_t datasize = (size == 19) ? size - 12 : size - 18;
+  const size_t cipher_pos = (size == 19) ? 5 : 11;
+
+  uint8_t iv[IV_SIZE];
+  for (uint8_t i = 0; i < 6; i++)
+    iv[i] = (uint8_t)(address >> (8 * i));  // MAC address reverse
+  memcpy(iv + 6, raw + 2, 3);                // sensor type (2) + packet id (1)
+  memcpy(iv + 9, raw + size - 7, 3);         // payload counter
+
+  // CCM decrypts in place, the IV and tag are outside of the ciphertext
+  int ret = mbedtls_ccm_auth_decrypt(&this->ctx_, datasize, iv, IV_SIZE, AUTHDATA, sizeof(AUTHDATA),
+                                     raw + cipher_pos, raw + cipher_pos, raw + size - TAG_SIZE, TAG_SIZE);
+  if (ret) {
+    ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): authenticated decryption failed.");
+    ESP_LOGVV(TAG, "  MAC address : %02X:%02X:%02X:%02X:%02X:%02X", iv[5], iv[4], iv[3], iv[2], iv[1], iv[0]);
+    ESP_LOGVV(TAG, "       Packet : %s", format_hex_pretty(raw, size).c_str());
+    ESP_LOGVV(TAG, "          Key : %s", format_hex_pretty(this->key_, sizeof(this->key_)).c_str());
+    ESP_LOGVV(TAG, "           Iv : %s", format_hex_pretty(iv, IV_SIZE).c_str());
+    ESP_LOGVV(TAG, "          Tag : %s", format_hex_pretty(raw + size - TAG_SIZE, TAG_SIZE).c_str());
+    return false;
+  }
+
+  // clear encrypted flag
+  raw[0] &= ~0x08;
+
+  ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): authenticated decryption passed.");
+  ESP_LOGVV(TAG, "  Plaintext : %s, Packet : %d", format_hex_pretty(raw + cipher_pos, datasize).c_str(),
+            static_cast<int>(raw[4]));
+  return true;
+}
+
+}  // namespace xiaomi_ble
+}  // namespace esphome
+
+#endif
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+// Only needs mbedtls, which is part of ESP-IDF. Host builds link the system library.
+#if defined(USE_ESP32) || defined(USE_HOST)
+
+#include <cstddef>
+#include <cstdint>
+#include "mbedtls/ccm.h"
+
+namespace esphome {
+namespace xiaomi_ble {
+
+/** AES-CCM decryption of MiBeacon payloads with a fixed bindkey.
+ *
+ * The AES key schedule runs once in set_key() and the context is reused for every advertisement, so a decrypt
+ * only costs the CCM pass over the payload itself.
+ */
+class XiaomiCipher {
+ public:
+  /// Largest encrypted payload (MiBeacon v4/v5 with MAC address and capability byte).
+  static const size_t MAX_PAYLOAD_SIZE = 24;
+
+  XiaomiCipher() { mbedtls_ccm_init(&this->ctx_); }
+  XiaomiCipher(const XiaomiCipher &) = delete;
+  XiaomiCipher &operator=(const XiaomiCipher &) = delete;
+  ~XiaomiCipher() { mbedtls_ccm_free(&this->ctx_); }
+
+  /// Set the 16 byte bindkey.
+  bool set_key(const uint8_t *bindkey);
+  /// Decrypt a payload in place and clear its encryption flag.
+  bool decrypt(uint8_t *raw, size_t size, const uint64_t &address);
+  /// Decrypt a copy of raw into out, which must hold MAX_PAYLOAD_SIZE bytes.
+  bool decrypt(const uint8_t *raw, size_t size, uint8_t *out, const uint64_t &address);
+
+ protected:
+  mbedtls_ccm_context ctx_;
+  uint8_t key_[16]{};
+  bool has_key_{false};
+};
+
+}  // namespace xiaomi_ble
+}  // namespace esphome
+
+#endif
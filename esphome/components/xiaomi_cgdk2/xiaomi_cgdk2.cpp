@@ -32,12 +32,15 @@ bool XiaomiCGDK2::parse_device(const esp32_ble_tracker::ESPBTDevice &device) {
     if (res->is_duplicate) {
       continue;
     }
-    if (res->has_encryption &&
-        (!(xiaomi_ble::decrypt_xiaomi_payload(const_cast<std::vector<uint8_t> &>(service_data.data), this->bindkey_,
-                                              this->address_)))) {
-      continue;
+    esp32_ble_tracker::AdvDataView message = service_data.data;
+    uint8_t decrypted[xiaomi_ble::XiaomiCipher::MAX_PAYLOAD_SIZE];
+    if (res->has_encryption) {
+      // The advertisement is read-only, decrypt a copy
+      if (!this->cipher_.decrypt(message.data(), message.size(), decrypted, this->address_))
+        continue;
+      message = esp32_ble_tracker::AdvDataView(decrypted, message.size());
     }
-    if (!(xiaomi_ble::parse_xiaomi_message(service_data.data, *res))) {
+    if (!(xiaomi_ble::parse_xiaomi_message(message, *res))) {
       continue;
     }
     if (!(xiaomi_ble::report_xiaomi_results(res, device.address_str()))) {
@@ -65,6 +68,7 @@ void XiaomiCGDK2::set_bindkey(const std::string &bindkey) {
     strncpy(temp, &(bindkey.c_str()[i * 2]), 2);
     bindkey_[i] = std::strtoul(temp, nullptr, 16);
   }
+  this->cipher_.set_key(this->bindkey_);
 }
 
 }  // namespace xiaomi_cgdk2
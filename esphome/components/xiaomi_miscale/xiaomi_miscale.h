@@ -33,9 +33,9 @@ class XiaomiMiscale : public Component, public esp32_ble_tracker::ESPBTDeviceLis
   bool clear_impedance_{false};
 
   optional<ParseResult> parse_header_(const esp32_ble_tracker::ServiceData &service_data);
-  bool parse_message_(const std::vector<uint8_t> &message, ParseResult &result);
-  bool parse_message_v1_(const std::vector<uint8_t> &message, ParseResult &result);
-  bool parse_message_v2_(const std::vector<uint8_t> &message, ParseResult &result);
+  bool parse_message_(const esp32_ble_tracker::AdvDataView &message, ParseResult &result);
+  bool parse_message_v1_(const esp32_ble_tracker::AdvDataView &message, ParseResult &result);
+  bool parse_message_v2_(const esp32_ble_tracker::AdvDataView &message, ParseResult &result);
   bool report_results_(const optional<ParseResult> &result, const std::string &address);
 };
 
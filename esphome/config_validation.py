@@ -1431,7 +1431,7 @@ class GenerateID(Optional):
 
 
 class SplitDefault(Optional):
-    """Mark this key to have a split default for ESP8266/ESP32."""
+    """Mark this key to have a split default for ESP8266/ESP32/host."""
 
     def __init__(
         self,
@@ -1440,6 +1440,7 @@ class SplitDefault(Optional):
         esp32=vol.UNDEFINED,
         esp32_arduino=vol.UNDEFINED,
         esp32_idf=vol.UNDEFINED,
+        host=vol.UNDEFINED,
     ):
         super().__init__(key)
         self._esp8266_default = vol.default_factory(esp8266)
@@ -1449,6 +1450,7 @@ class SplitDefault(Optional):
         self._esp32_idf_default = vol.default_factory(
             esp32_idf if esp32 is vol.UNDEFINED else esp32
         )
+        self._host_default = vol.default_factory(host)
 
     @property
     def default(self):
@@ -1458,6 +1460,8 @@ class SplitDefault(Optional):
             return self._esp32_arduino_default
         if CORE.is_esp32 and CORE.using_esp_idf:
             return self._esp32_idf_default
+        if CORE.is_host:
+            return self._host_default
         raise NotImplementedError
 
     @default.setter
@@ -6,8 +6,9 @@ ALLOWED_NAME_CHARS = "abcdefghijklmnopqrstuvwxyz0123456789-_"
 
 PLATFORM_ESP32 = "esp32"
 PLATFORM_ESP8266 = "esp8266"
+PLATFORM_HOST = "host"
 
-TARGET_PLATFORMS = [PLATFORM_ESP32, PLATFORM_ESP8266]
+TARGET_PLATFORMS = [PLATFORM_ESP32, PLATFORM_ESP8266, PLATFORM_HOST]
 
 SOURCE_FILE_EXTENSIONS = {".cpp", ".hpp", ".h", ".c", ".tcc", ".ino"}
 HEADER_FILE_EXTENSIONS = {".h", ".hpp", ".tcc"}
@@ -291,6 +292,7 @@ CONF_IDENTITY = "identity"
 CONF_IDLE = "idle"
 CONF_IDLE_ACTION = "idle_action"
 CONF_IDLE_LEVEL = "idle_level"
+CONF_IDLE_SLEEP = "idle_sleep"
 CONF_IDLE_TIME = "idle_time"
 CONF_IF = "if"
 CONF_IGNORE_EFUSE_MAC_CRC = "ignore_efuse_mac_crc"
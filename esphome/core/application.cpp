@@ -7,10 +7,29 @@
 #include "esphome/components/status_led/status_led.h"
 #endif
 
+#ifdef USE_LOOP_IDLE_SLEEP
+#ifdef USE_SOCKET_IMPL_BSD_SOCKETS
+#include "esphome/components/socket/headers.h"
+#include <algorithm>
+#include <netinet/in.h>
+#include <sys/select.h>
+#endif
+#ifdef USE_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/timers.h>
+#endif
+#endif
+
 namespace esphome {
 
 static const char *const TAG = "app";
 
+#ifdef USE_LOOP_IDLE_SLEEP
+/// Longest time the main loop blocks when all components are idle, so that the watchdog is still fed.
+static const uint32_t MAX_IDLE_SLEEP_MS = 1000;
+#endif
+
 void Application::register_component_(Component *comp) {
   if (comp == nullptr) {
     ESP_LOGW(TAG, "Tried to register null component!");
@@ -62,17 +81,48 @@ void Application::setup() {
   ESP_LOGI(TAG, "setup() finished successfully!");
   this->schedule_dump_config();
   this->calculate_looping_components_();
+#ifdef USE_LOOP_PROFILER
+  this->profiler.init(this->components_, this->looping_components_);
+  this->expected_wake_us_ = micros();
+  this->profiler.reset_window(millis());
+#endif
+#ifdef USE_LOOP_IDLE_SLEEP
+  this->setup_wake_();
+#endif
 }
 void Application::loop() {
   uint32_t new_app_state = 0;
 
+#ifdef USE_LOOP_PROFILER
+  const uint32_t iteration_start = micros();
+  this->profiler.record_iteration_start(iteration_start, this->expected_wake_us_);
+#endif
+
+  if (this->has_pending_enable_loop_)
+    this->enable_pending_loops_();
+
   this->scheduler.call();
   this->feed_wdt();
-  for (Component *component : this->looping_components_) {
+#ifdef USE_LOOP_IDLE_SLEEP
+  bool all_idle = true;
+#endif
+  for (size_t i = 0; i < this->looping_components_.size(); i++) {
+    Component *component = this->looping_components_[i];
+    if (component->is_loop_disabled())
+      continue;
+#ifdef USE_LOOP_IDLE_SLEEP
+    all_idle = false;
+#endif
+#ifdef USE_LOOP_PROFILER
+    const uint32_t component_start = micros();
+#endif
     {
       WarnIfComponentBlockingGuard guard{component};
       component->call();
     }
+#ifdef USE_LOOP_PROFILER
+    this->profiler.record_loop(i, micros() - component_start);
+#endif
     new_app_state |= component->get_component_state();
     this->app_state_ |= new_app_state;
     this->feed_wdt();
@@ -80,6 +130,12 @@ void Application::loop() {
   this->app_state_ = new_app_state;
 
   const uint32_t now = millis();
+#ifdef USE_LOOP_PROFILER
+  const uint32_t iteration_end = micros();
+  this->profiler.record_iteration(iteration_end - iteration_start);
+  // Without a sleep the next iteration is expected right away
+  this->expected_wake_us_ = iteration_end;
+#endif
 
   if (HighFrequencyLoopRequester::is_high_frequency()) {
     yield();
@@ -92,8 +148,21 @@ void Application::loop() {
     // next_schedule is max 0.5*delay_time
     // otherwise interval=0 schedules result in constant looping with almost no sleep
     next_schedule = std::max(next_schedule, delay_time / 2);
+#ifdef USE_LOOP_IDLE_SLEEP
+    // Nothing to poll, sleep until the next timeout/interval or until woken up by an event
+    if (all_idle && this->dump_config_at_ >= this->components_.size()) {
+      delay_time = std::min(this->scheduler.next_schedule_in().value_or(MAX_IDLE_SLEEP_MS), MAX_IDLE_SLEEP_MS);
+      delay_time = std::max(delay_time, this->loop_interval_ / 2);
+    } else {
+      delay_time = std::min(next_schedule, delay_time);
+    }
+#else
     delay_time = std::min(next_schedule, delay_time);
-    delay(delay_time);
+#endif
+#ifdef USE_LOOP_PROFILER
+    this->expected_wake_us_ = iteration_end + delay_time * 1000;
+#endif
+    this->wait_for_event_(delay_time);
   }
   this->last_loop_ = now;
 
@@ -107,6 +176,10 @@ void Application::loop() {
 
     this->components_[this->dump_config_at_]->call_dump_config();
     this->dump_config_at_++;
+#ifdef USE_LOOP_IDLE_SLEEP
+    if (this->dump_config_at_ == this->components_.size())
+      this->dump_idle_sleep_config_();
+#endif
   }
 }
 
@@ -145,6 +218,178 @@ void Application::run_safe_shutdown_hooks() {
   }
 }
 
+void Application::enable_pending_loops_() {
+  // Clear first, requests that come in while iterating are handled on the next loop iteration
+  this->has_pending_enable_loop_ = false;
+  for (auto *component : this->looping_components_) {
+    if (component->pending_enable_loop_)
+      component->enable_loop();
+  }
+}
+
+#ifndef USE_LOOP_IDLE_SLEEP
+void IRAM_ATTR Application::wake_loop_any_context() {}
+void Application::wait_for_event_(uint32_t timeout_ms) { delay(timeout_ms); }
+#else
+void Application::dump_idle_sleep_config_() {
+  std::string awake;
+  for (auto *component : this->looping_components_) {
+    if (component->is_loop_disabled())
+      continue;
+    if (!awake.empty())
+      awake += ", ";
+    awake += component->get_component_source();
+  }
+  if (awake.empty()) {
+    ESP_LOGCONFIG(TAG, "Idle sleep: all component loops are idle");
+  } else {
+    // Components that poll in loop() (e.g. wifi, api, logger, ota, web_server) never let the main loop sleep
+    ESP_LOGCONFIG(TAG, "Idle sleep: the loop is kept awake by %s", awake.c_str());
+  }
+}
+
+#ifdef USE_SOCKET_IMPL_BSD_SOCKETS
+void Application::setup_wake_() {
+  // A datagram sent to this loopback socket interrupts select() in wait_for_event_()
+  int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+  if (fd < 0) {
+    ESP_LOGW(TAG, "Could not create wake socket, idle sleep is limited to the loop interval");
+    return;
+  }
+  struct sockaddr_in addr {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = 0;
+  socklen_t addr_len = sizeof(addr);
+  if (::bind(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0 ||
+      ::getsockname(fd, reinterpret_cast<struct sockaddr *>(&addr), &addr_len) != 0) {
+    ESP_LOGW(TAG, "Could not bind wake socket, idle sleep is limited to the loop interval");
+    ::close(fd);
+    return;
+  }
+  ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+  this->wake_port_ = ntohs(addr.sin_port);
+  this->wake_fd_ = fd;
+}
+void Application::send_wake_(void *app, uint32_t unused) {
+  auto *self = static_cast<Application *>(app);
+  struct sockaddr_in addr {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = htons(self->wake_port_);
+  const uint8_t data = 0;
+  ::sendto(self->wake_fd_, &data, 1, 0, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr));
+}
+void IRAM_ATTR Application::wake_loop_any_context() {
+  this->wake_requested_ = true;
+  if (this->wake_fd_ < 0)
+    return;
+#ifdef USE_ESP32
+  if (xPortInIsrContext()) {
+    // Sockets can't be used from an ISR, let the timer task send the wake-up
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    xTimerPendFunctionCallFromISR(send_wake_, this, 0, &higher_priority_task_woken);
+    portYIELD_FROM_ISR(higher_priority_task_woken);
+    return;
+  }
+#endif
+  send_wake_(this, 0);
+}
+void Application::register_socket_fd(int fd) {
+  if (fd >= 0)
+    this->socket_fds_.push_back(fd);
+}
+void Application::unregister_socket_fd(int fd) {
+  this->socket_fds_.erase(std::remove(this->socket_fds_.begin(), this->socket_fds_.end(), fd),
+                          this->socket_fds_.end());
+  this->ready_socket_fds_.erase(std::remove(this->ready_socket_fds_.begin(), this->ready_socket_fds_.end(), fd),
+                                this->ready_socket_fds_.end());
+}
+void Application::rearm_socket_fd(int fd) {
+  auto it = std::find(this->ready_socket_fds_.begin(), this->ready_socket_fds_.end(), fd);
+  if (it == this->ready_socket_fds_.end())
+    return;
+  this->ready_socket_fds_.erase(it);
+  this->socket_fds_.push_back(fd);
+}
+void Application::wait_for_event_(uint32_t timeout_ms) {
+  if (this->wake_fd_ < 0) {
+    delay(std::min(timeout_ms, this->loop_interval_));
+    return;
+  }
+  if (this->wake_requested_) {
+    this->wake_requested_ = false;
+    return;
+  }
+
+  fd_set read_fds;
+  FD_ZERO(&read_fds);
+  FD_SET(this->wake_fd_, &read_fds);
+  int max_fd = this->wake_fd_;
+  for (int fd : this->socket_fds_) {
+    FD_SET(fd, &read_fds);
+    max_fd = std::max(max_fd, fd);
+  }
+  struct timeval tv {};
+  tv.tv_sec = timeout_ms / 1000;
+  tv.tv_usec = (timeout_ms % 1000) * 1000;
+  int ret = ::select(max_fd + 1, &read_fds, nullptr, nullptr, &tv);
+  if (ret < 0) {
+    // Most likely a socket was closed without being unregistered, don't spin
+    delay(std::min(timeout_ms, this->loop_interval_));
+  } else if (ret > 0) {
+    if (FD_ISSET(this->wake_fd_, &read_fds)) {
+      uint8_t buf[16];
+      while (::recv(this->wake_fd_, buf, sizeof(buf), 0) > 0) {
+      }
+    }
+    // Don't wait on readable sockets again until they are read, see rearm_socket_fd()
+    for (size_t i = 0; i < this->socket_fds_.size();) {
+      const int fd = this->socket_fds_[i];
+      if (FD_ISSET(fd, &read_fds)) {
+        this->ready_socket_fds_.push_back(fd);
+        this->socket_fds_[i] = this->socket_fds_.back();
+        this->socket_fds_.pop_back();
+      } else {
+        i++;
+      }
+    }
+  }
+  this->wake_requested_ = false;
+}
+#elif defined(USE_ESP32)
+void Application::setup_wake_() { this->loop_task_handle_ = xTaskGetCurrentTaskHandle(); }
+void IRAM_ATTR Application::wake_loop_any_context() {
+  this->wake_requested_ = true;
+  auto *task = static_cast<TaskHandle_t>(this->loop_task_handle_);
+  if (task == nullptr)
+    return;
+  if (xPortInIsrContext()) {
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(task, &higher_priority_task_woken);
+    portYIELD_FROM_ISR(higher_priority_task_woken);
+  } else {
+    xTaskNotifyGive(task);
+  }
+}
+void Application::wait_for_event_(uint32_t timeout_ms) {
+  if (!this->wake_requested_)
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeout_ms));
+  this->wake_requested_ = false;
+}
+#else
+void Application::setup_wake_() {}
+void IRAM_ATTR Application::wake_loop_any_context() { this->wake_requested_ = true; }
+void Application::wait_for_event_(uint32_t timeout_ms) {
+  // No blocking primitive to wait on, sleep in short steps and check for wake-ups in between
+  const uint32_t start = millis();
+  while (!this->wake_requested_ && millis() - start < timeout_ms)
+    delay(1);
+  this->wake_requested_ = false;
+}
+#endif
+#endif  // USE_LOOP_IDLE_SLEEP
+
 void Application::calculate_looping_components_() {
   for (auto *obj : this->components_) {
     if (obj->has_overridden_loop())
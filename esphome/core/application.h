@@ -7,6 +7,7 @@
 #include "esphome/core/component.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
+#include "esphome/core/profiler.h"
 #include "esphome/core/scheduler.h"
 
 #ifdef USE_BINARY_SENSOR
@@ -155,6 +156,31 @@ class Application {
 
   void schedule_dump_config() { this->dump_config_at_ = 0; }
 
+  /** Wake up the main loop if it is blocked in idle sleep. Safe to call from ISRs and other tasks.
+   *
+   * Without idle sleep (see `esphome: idle_sleep:`) the main loop never blocks longer than the loop interval,
+   * and this does nothing.
+   */
+  void wake_loop_any_context();
+
+  /// Process pending Component::enable_loop_soon_any_context() calls on the next loop iteration.
+  void request_loop_enable_any_context() {
+    this->has_pending_enable_loop_ = true;
+    this->wake_loop_any_context();
+  }
+
+#ifdef USE_LOOP_IDLE_SLEEP
+  /// Wake up the main loop from idle sleep when this socket becomes readable.
+  void register_socket_fd(int fd);
+  void unregister_socket_fd(int fd);
+  /** Wait for new data on this socket again, called by the socket whenever it is read from.
+   *
+   * Once a socket is reported readable it is left out of the wait until its owner reads it, otherwise an owner that
+   * reads later (or never) would make every wait return right away.
+   */
+  void rearm_socket_fd(int fd);
+#endif
+
   void feed_wdt();
 
   void reboot();
@@ -285,6 +311,10 @@ class Application {
 
   Scheduler scheduler;
 
+#ifdef USE_LOOP_PROFILER
+  LoopProfiler profiler;
+#endif
+
  protected:
   friend Component;
 
@@ -294,6 +324,20 @@ class Application {
 
   void feed_wdt_arch_();
 
+  void enable_pending_loops_();
+
+  /// Sleep for at most timeout_ms, returning early if wake_loop_any_context() is called (idle sleep only).
+  void wait_for_event_(uint32_t timeout_ms);
+
+#ifdef USE_LOOP_IDLE_SLEEP
+  /// Log the components that keep the main loop from sleeping, once all components dumped their config.
+  void dump_idle_sleep_config_();
+  void setup_wake_();
+#ifdef USE_SOCKET_IMPL_BSD_SOCKETS
+  static void send_wake_(void *app, uint32_t unused);
+#endif
+#endif
+
   std::vector<Component *> components_{};
   std::vector<Component *> looping_components_{};
 
@@ -341,9 +385,25 @@ class Application {
   std::string compilation_time_;
   bool name_add_mac_suffix_;
   uint32_t last_loop_{0};
+#ifdef USE_LOOP_PROFILER
+  uint32_t expected_wake_us_{0};
+#endif
   uint32_t loop_interval_{16};
   size_t dump_config_at_{SIZE_MAX};
   uint32_t app_state_{0};
+  volatile bool has_pending_enable_loop_{false};
+#ifdef USE_LOOP_IDLE_SLEEP
+  volatile bool wake_requested_{false};
+#ifdef USE_SOCKET_IMPL_BSD_SOCKETS
+  std::vector<int> socket_fds_{};
+  /// Sockets that were reported readable and have not been read from since.
+  std::vector<int> ready_socket_fds_{};
+  int wake_fd_{-1};
+  uint16_t wake_port_{0};
+#elif defined(USE_ESP32)
+  void *loop_task_handle_{nullptr};
+#endif
+#endif
 };
 
 /// Global storage of Application pointer - only one Application can exist.
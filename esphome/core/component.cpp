@@ -133,6 +133,15 @@ void Component::set_retry(uint32_t initial_wait_time, uint8_t max_attempts, std:
                           float backoff_increase_factor) {  // NOLINT
   App.scheduler.set_retry(this, "", initial_wait_time, max_attempts, std::move(f), backoff_increase_factor);
 }
+void Component::disable_loop() { this->loop_disabled_ = true; }
+void Component::enable_loop() {
+  this->pending_enable_loop_ = false;
+  this->loop_disabled_ = false;
+}
+void IRAM_ATTR Component::enable_loop_soon_any_context() {
+  this->pending_enable_loop_ = true;
+  App.request_loop_enable_any_context();
+}
 bool Component::is_failed() { return (this->component_state_ & COMPONENT_STATE_MASK) == COMPONENT_STATE_FAILED; }
 bool Component::can_proceed() { return true; }
 bool Component::status_has_warning() { return this->component_state_ & STATUS_LED_WARNING; }
@@ -138,6 +138,26 @@ class Component {
 
   bool has_overridden_loop() const;
 
+  /** Stop calling loop() until enable_loop() is called.
+   *
+   * Meant for components that have nothing to do until some event happens, so that an idle component
+   * costs nothing in the main loop. With idle sleep enabled the main loop can block until an event
+   * once all looping components are disabled.
+   */
+  void disable_loop();
+
+  /// Resume calling loop(), must be called from the main loop.
+  void enable_loop();
+
+  /** Resume calling loop() on the next main loop iteration.
+   *
+   * Unlike enable_loop() this is safe to call from ISRs and other tasks, and wakes up the main loop
+   * if it is sleeping.
+   */
+  void enable_loop_soon_any_context();
+
+  bool is_loop_disabled() const { return this->loop_disabled_; }
+
   /** Set where this component was loaded from for some debug messages.
    *
    * This is set by the ESPHome core, and should not be called manually.
@@ -253,6 +273,8 @@ class Component {
   bool cancel_defer(const std::string &name);  // NOLINT
 
   uint32_t component_state_{0x0000};  ///< State of this component.
+  bool loop_disabled_{false};
+  volatile bool pending_enable_loop_{false};
   float setup_priority_override_{NAN};
   const char *component_source_ = nullptr;
 };
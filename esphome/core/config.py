@@ -13,6 +13,7 @@ from esphome.const import (
     CONF_COMMENT,
     CONF_ESPHOME,
     CONF_FRAMEWORK,
+    CONF_IDLE_SLEEP,
     CONF_INCLUDES,
     CONF_LIBRARIES,
     CONF_NAME,
@@ -128,6 +129,10 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_INCLUDES, default=[]): cv.ensure_list(valid_include),
             cv.Optional(CONF_LIBRARIES, default=[]): cv.ensure_list(cv.string_strict),
             cv.Optional(CONF_NAME_ADD_MAC_SUFFIX, default=False): cv.boolean,
+            # Block the main loop while every component loop is disabled. Components that poll in loop()
+            # (wifi, api, logger, ota, web_server, ...) keep it awake, so this only saves power in configs
+            # without them. The components keeping it awake are logged with the config.
+            cv.Optional(CONF_IDLE_SLEEP, default=False): cv.boolean,
             cv.Optional(CONF_PROJECT): cv.Schema(
                 {
                     cv.Required(CONF_NAME): cv.All(
@@ -345,6 +350,9 @@ async def to_code(config):
     if CORE.using_arduino:
         CORE.add_job(add_arduino_global_workaround)
 
+    if config[CONF_IDLE_SLEEP]:
+        cg.add_define("USE_LOOP_IDLE_SLEEP")
+
     if config[CONF_INCLUDES]:
         CORE.add_job(add_includes, config[CONF_INCLUDES])
 
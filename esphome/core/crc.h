@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+
+/** Table-driven CRC calculations.
+ *
+ * Each CRC has an update function that continues a running checksum, so streaming parsers can feed data as it
+ * arrives: pass the initial value of the variant for the first block and the result of the previous call for the
+ * next ones. Final XORs are left to the caller (or to the one-shot helpers). The tables take one byte per step and
+ * are stored in flash (PROGMEM on the ESP8266).
+ */
+
+/// CRC-8/MAXIM (Dallas 1-Wire), reflected polynomial 0x31.
+uint8_t crc8_maxim_update(uint8_t crc, const uint8_t *data, size_t len);
+/// CRC-8/MAXIM with initial value 0.
+inline uint8_t crc8_maxim(const uint8_t *data, size_t len) { return crc8_maxim_update(0, data, len); }
+
+/// CRC-16 with reflected polynomial 0x8005 (CRC-16/MODBUS starts with 0xFFFF, CRC-16/ARC with 0).
+uint16_t crc16_update(uint16_t crc, const uint8_t *data, size_t len);
+/// CRC-16/MODBUS, the low byte is transmitted first.
+inline uint16_t crc16_modbus(const uint8_t *data, size_t len) { return crc16_update(0xFFFF, data, len); }
+
+/// CRC-16 with reflected polynomial 0x1021 (CRC-16/KERMIT starts with 0, CRC-16/X-25 starts with and inverts
+/// the result with 0xFFFF).
+uint16_t crc16_ccitt_reflected_update(uint16_t crc, const uint8_t *data, size_t len);
+
+/// CRC-16 with polynomial 0x1021, most significant bit first (CRC-16/XMODEM starts with 0, CRC-16/CCITT-FALSE with
+/// 0xFFFF).
+uint16_t crc16_ccitt_update(uint16_t crc, const uint8_t *data, size_t len);
+/// CRC-16/XMODEM.
+inline uint16_t crc16_xmodem(const uint8_t *data, size_t len) { return crc16_ccitt_update(0, data, len); }
+
+/// CRC-32 (IEEE 802.3) with reflected polynomial 0x04C11DB7, start with 0xFFFFFFFF and invert the result.
+uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t len);
+/// CRC-32 (IEEE 802.3) as used by zlib and Ethernet.
+inline uint32_t crc32(const uint8_t *data, size_t len) { return ~crc32_update(0xFFFFFFFF, data, len); }
+
+}  // namespace esphome
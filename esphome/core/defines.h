@@ -28,6 +28,9 @@
 #define USE_LIGHT
 #define USE_LOCK
 #define USE_LOGGER
+#define USE_LOGGER_DEFERRED
+#define USE_LOOP_IDLE_SLEEP
+#define USE_LOOP_PROFILER
 #define USE_MDNS
 #define USE_MEDIA_PLAYER
 #define USE_MQTT
@@ -90,6 +93,11 @@
 #define USE_SOCKET_IMPL_LWIP_TCP
 #endif
 
+// Host-specific feature flags
+#ifdef USE_HOST
+#define USE_SOCKET_IMPL_BSD_SOCKETS
+#endif
+
 // Disabled feature flags
 //#define USE_BSEC  // Requires a library with proprietary license.
 
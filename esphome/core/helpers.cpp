@@ -1,5 +1,6 @@
 #include "esphome/core/helpers.h"
 
+#include "esphome/core/crc.h"
 #include "esphome/core/defines.h"
 #include "esphome/core/hal.h"
 
@@ -21,6 +22,12 @@
 #include "esp_system.h"
 #include <freertos/FreeRTOS.h>
 #include <freertos/portmacro.h>
+#elif defined(USE_HOST)
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/random.h>
+#include <sys/socket.h>
+#include <unistd.h>
 #endif
 
 #ifdef USE_ESP32_IGNORE_EFUSE_MAC_CRC
@@ -47,21 +54,7 @@ std::string to_string(long double value) { return str_snprintf("%Lf", 32, value)
 // Mathematics
 
 float lerp(float completion, float start, float end) { return start + (end - start) * completion; }
-uint8_t crc8(uint8_t *data, uint8_t len) {
-  uint8_t crc = 0;
-
-  while ((len--) != 0u) {
-    uint8_t inbyte = *data++;
-    for (uint8_t i = 8; i != 0u; i--) {
-      bool mix = (crc ^ inbyte) & 0x01;
-      crc >>= 1;
-      if (mix)
-        crc ^= 0x8C;
-      inbyte >>= 1;
-    }
-  }
-  return crc;
-}
+uint8_t crc8(uint8_t *data, uint8_t len) { return crc8_maxim(data, len); }
 uint32_t fnv1_hash(const std::string &str) {
   uint32_t hash = 2166136261UL;
   for (char c : str) {
@@ -76,6 +69,10 @@ uint32_t random_uint32() {
   return esp_random();
 #elif defined(USE_ESP8266)
   return os_random();
+#elif defined(USE_HOST)
+  uint32_t value = 0;
+  random_bytes(reinterpret_cast<uint8_t *>(&value), sizeof(value));
+  return value;
 #else
 #error "No random source available for this configuration."
 #endif
@@ -87,6 +84,15 @@ bool random_bytes(uint8_t *data, size_t len) {
   return true;
 #elif defined(USE_ESP8266)
   return os_get_random(data, len) == 0;
+#elif defined(USE_HOST)
+  while (len > 0) {
+    ssize_t ret = getrandom(data, len, 0);
+    if (ret < 0)
+      return false;
+    data += ret;
+    len -= ret;
+  }
+  return true;
 #else
 #error "No random source available for this configuration."
 #endif
@@ -105,7 +111,7 @@ std::string str_truncate(const std::string &str, size_t length) {
   return str.length() > length ? str.substr(0, length) : str;
 }
 std::string str_until(const char *str, char ch) {
-  char *pos = strchr(str, ch);
+  const char *pos = strchr(str, ch);
   return pos == nullptr ? std::string(str) : std::string(str, pos - str);
 }
 std::string str_until(const std::string &str, char ch) { return str.substr(0, str.find(ch)); }
@@ -351,6 +357,10 @@ IRAM_ATTR InterruptLock::~InterruptLock() { xt_wsr_ps(xt_state_); }
 // so should not be used as a mutex lock, only to get accurate timing
 IRAM_ATTR InterruptLock::InterruptLock() { portDISABLE_INTERRUPTS(); }
 IRAM_ATTR InterruptLock::~InterruptLock() { portENABLE_INTERRUPTS(); }
+#elif defined(USE_HOST)
+// there are no interrupts on the host, everything runs in the main loop
+InterruptLock::InterruptLock() {}
+InterruptLock::~InterruptLock() {}
 #endif
 
 uint8_t HighFrequencyLoopRequester::num_requests = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -381,6 +391,27 @@ void get_mac_address_raw(uint8_t *mac) {
 #endif
 #elif defined(USE_ESP8266)
   wifi_get_macaddr(STATION_IF, mac);
+#elif defined(USE_HOST)
+  // Use the address of the first interface that has one, so the node keeps the same identity across runs
+  memset(mac, 0, 6);
+  int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+  if (fd < 0)
+    return;
+  struct if_nameindex *interfaces = if_nameindex();
+  for (auto *it = interfaces; it != nullptr && it->if_index != 0; it++) {
+    struct ifreq ifr {};
+    strncpy(ifr.ifr_name, it->if_name, IFNAMSIZ - 1);
+    if (ioctl(fd, SIOCGIFHWADDR, &ifr) != 0)
+      continue;
+    const auto *addr = reinterpret_cast<const uint8_t *>(ifr.ifr_hwaddr.sa_data);
+    if (std::all_of(addr, addr + 6, [](uint8_t b) { return b == 0; }))
+      continue;
+    memcpy(mac, addr, 6);
+    break;
+  }
+  if (interfaces != nullptr)
+    if_freenameindex(interfaces);
+  ::close(fd);
 #endif
 }
 std::string get_mac_address() {
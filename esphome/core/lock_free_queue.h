@@ -0,0 +1,63 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace esphome {
+
+/** A bounded lock-free queue between one producer and one consumer.
+ *
+ * Elements are constructed in place in preallocated slots, so neither side allocates or takes a lock: all SIZE slots
+ * are part of the object, whether in use or not. Meant for handing events from another task (e.g. the Bluetooth host
+ * task) to loop(), the only consumer. When all slots are in use the element is dropped and counted. SIZE must be a
+ * power of two.
+ */
+template<class T, size_t SIZE> class LockFreeQueue {
+  static_assert(SIZE > 0 && (SIZE & (SIZE - 1)) == 0, "Queue size must be a power of two");
+
+ public:
+  /// Construct an element in the next free slot, returns false if the queue is full. Producer only.
+  template<typename... Args> bool push(Args &&...args) {
+    const uint32_t head = this->head_.load(std::memory_order_relaxed);
+    if (head - this->tail_.load(std::memory_order_acquire) == SIZE) {
+      this->dropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    new (this->slot_(head)) T(std::forward<Args>(args)...);
+    this->head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// The oldest element, nullptr if the queue is empty. It stays valid until pop(). Consumer only.
+  T *front() {
+    const uint32_t tail = this->tail_.load(std::memory_order_relaxed);
+    if (tail == this->head_.load(std::memory_order_acquire))
+      return nullptr;
+    return this->slot_(tail);
+  }
+  /// Free the slot of the element returned by front(). Consumer only.
+  void pop() {
+    const uint32_t tail = this->tail_.load(std::memory_order_relaxed);
+    this->slot_(tail)->~T();
+    this->tail_.store(tail + 1, std::memory_order_release);
+  }
+
+  /// Total number of elements dropped because the queue was full.
+  uint32_t get_dropped() const { return this->dropped_.load(std::memory_order_relaxed); }
+
+ protected:
+  T *slot_(uint32_t index) { return reinterpret_cast<T *>(&this->slots_[index & (SIZE - 1)]); }
+
+  typename std::aligned_storage<sizeof(T), alignof(T)>::type slots_[SIZE];
+  /// Written by the producer.
+  std::atomic<uint32_t> head_{0};
+  /// Written by the consumer.
+  std::atomic<uint32_t> tail_{0};
+  std::atomic<uint32_t> dropped_{0};
+};
+
+}  // namespace esphome
@@ -0,0 +1,116 @@
+#include "esphome/core/profiler.h"
+
+#ifdef USE_LOOP_PROFILER
+
+#include "esphome/core/component.h"
+#include <algorithm>
+
+namespace esphome {
+
+void RuntimeStats::record(uint32_t us) {
+  this->count++;
+  this->sum_us += us;
+  this->total_count++;
+  this->total_us += us;
+  if (us > this->max_us)
+    this->max_us = us;
+
+  // Bucket b holds samples below 2^b us, the last bucket everything above
+  uint8_t bucket = 0;
+  while (us != 0 && bucket < BUCKETS - 1) {
+    us >>= 1;
+    bucket++;
+  }
+  if (this->histogram[bucket] != UINT16_MAX)
+    this->histogram[bucket]++;
+}
+uint32_t RuntimeStats::percentile(float p) const {
+  if (this->count == 0)
+    return 0;
+  uint32_t samples = 0;
+  for (uint8_t i = 0; i < BUCKETS; i++)
+    samples += this->histogram[i];
+  const uint32_t target = std::max<uint32_t>(1, samples * p + 0.5f);
+  uint32_t seen = 0;
+  for (uint8_t i = 0; i < BUCKETS - 1; i++) {
+    seen += this->histogram[i];
+    if (seen >= target)
+      return std::min((uint32_t(1) << i) - 1, this->max_us);
+  }
+  return this->max_us;
+}
+void RuntimeStats::reset_window() {
+  this->count = 0;
+  this->max_us = 0;
+  this->sum_us = 0;
+  std::fill(std::begin(this->histogram), std::end(this->histogram), 0);
+}
+
+void LoopProfiler::init(const std::vector<Component *> &components,
+                        const std::vector<Component *> &looping_components) {
+  this->components_.resize(components.size());
+  for (size_t i = 0; i < components.size(); i++)
+    this->components_[i].component = components[i];
+  // Sorted by address for lookups from the scheduler
+  std::sort(this->components_.begin(), this->components_.end(),
+            [](const ComponentProfile &a, const ComponentProfile &b) { return a.component < b.component; });
+
+  this->looping_profiles_.clear();
+  this->looping_profiles_.reserve(looping_components.size());
+  for (auto *component : looping_components)
+    this->looping_profiles_.push_back(this->get_component_profile(component));
+}
+void LoopProfiler::record_iteration_start(uint32_t now, uint32_t expected_start) {
+  const int32_t late = int32_t(now - expected_start);
+  this->jitter_.record(late > 0 ? late : 0);
+}
+void LoopProfiler::register_scheduler_item(Component *component, uint32_t name_hash, const std::string &name) {
+  for (auto &item : this->scheduler_items_) {
+    if (item.component == component && item.name_hash == name_hash)
+      return;
+  }
+  if (this->scheduler_items_.size() >= MAX_SCHEDULER_ITEMS)
+    return;
+  if (this->scheduler_items_.empty())
+    this->scheduler_items_.reserve(MAX_SCHEDULER_ITEMS);
+
+  SchedulerItemProfile item{};
+  item.component = component;
+  item.name_hash = name_hash;
+  item.name = name;
+  this->scheduler_items_.push_back(std::move(item));
+}
+void LoopProfiler::record_scheduler_item(Component *component, uint32_t name_hash, uint32_t us) {
+  auto *profile = this->get_component_profile(component);
+  if (profile != nullptr)
+    profile->scheduler.record(us);
+
+  for (auto &item : this->scheduler_items_) {
+    if (item.component == component && item.name_hash == name_hash) {
+      item.stats.record(us);
+      return;
+    }
+  }
+}
+ComponentProfile *LoopProfiler::get_component_profile(Component *component) {
+  auto it = std::lower_bound(this->components_.begin(), this->components_.end(), component,
+                             [](const ComponentProfile &a, Component *b) { return a.component < b; });
+  if (it == this->components_.end() || it->component != component)
+    return nullptr;
+  return &*it;
+}
+void LoopProfiler::reset_window(uint32_t now) {
+  for (auto &profile : this->components_) {
+    profile.loop.reset_window();
+    profile.scheduler.reset_window();
+  }
+  for (auto &item : this->scheduler_items_)
+    item.stats.reset_window();
+  this->iteration_.reset_window();
+  this->jitter_.reset_window();
+  this->window_start_ = now;
+}
+
+}  // namespace esphome
+
+#endif  // USE_LOOP_PROFILER
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_LOOP_PROFILER
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace esphome {
+
+class Component;
+
+/** Timing statistics of one code path, in microseconds.
+ *
+ * Samples are accumulated for a window (reset by the reporter after every report) and for the whole uptime.
+ * Percentiles are derived from a log2 histogram, so they are approximated to the upper bound of a power of two.
+ */
+struct RuntimeStats {
+  static const uint8_t BUCKETS = 16;
+
+  void record(uint32_t us);
+  /// Approximate the p-th percentile (0.0 - 1.0) of the current window.
+  uint32_t percentile(float p) const;
+  float average() const { return this->count == 0 ? 0.0f : float(this->sum_us) / float(this->count); }
+  void reset_window();
+
+  uint32_t count{0};
+  uint32_t max_us{0};
+  uint64_t sum_us{0};
+  uint32_t total_count{0};
+  uint64_t total_us{0};
+  uint16_t histogram[BUCKETS]{};
+};
+
+struct ComponentProfile {
+  Component *component;
+  /// Time spent in loop().
+  RuntimeStats loop;
+  /// Time spent in timeouts and intervals scheduled by this component.
+  RuntimeStats scheduler;
+};
+
+struct SchedulerItemProfile {
+  Component *component;
+  uint32_t name_hash;
+  std::string name;
+  RuntimeStats stats;
+};
+
+/** Collects main loop timing when the loop_profiler component is used.
+ *
+ * Recording never allocates: component profiles are created once in init() and scheduler items are
+ * registered when they are first set, up to MAX_SCHEDULER_ITEMS. Further items are only accounted for
+ * in the profile of their component.
+ */
+class LoopProfiler {
+ public:
+  static const size_t MAX_SCHEDULER_ITEMS = 32;
+
+  /// Create a profile for every component, called by the Application once setup() is done.
+  void init(const std::vector<Component *> &components, const std::vector<Component *> &looping_components);
+
+  /// Record the start of a main loop iteration that should have started at expected_start (both in micros).
+  void record_iteration_start(uint32_t now, uint32_t expected_start);
+  void record_iteration(uint32_t us) { this->iteration_.record(us); }
+  void record_loop(size_t looping_index, uint32_t us) {
+    if (looping_index < this->looping_profiles_.size())
+      this->looping_profiles_[looping_index]->loop.record(us);
+  }
+  void register_scheduler_item(Component *component, uint32_t name_hash, const std::string &name);
+  void record_scheduler_item(Component *component, uint32_t name_hash, uint32_t us);
+
+  ComponentProfile *get_component_profile(Component *component);
+  std::vector<ComponentProfile> &get_component_profiles() { return this->components_; }
+  std::vector<SchedulerItemProfile> &get_scheduler_item_profiles() { return this->scheduler_items_; }
+  /// Active time of a whole main loop iteration (scheduler and all components).
+  RuntimeStats &get_iteration_stats() { return this->iteration_; }
+  /// Lateness of a main loop iteration compared to the end of its requested sleep.
+  RuntimeStats &get_jitter_stats() { return this->jitter_; }
+  uint32_t get_window_start() const { return this->window_start_; }
+
+  /// Start a new statistics window for all profiles.
+  void reset_window(uint32_t now);
+
+ protected:
+  std::vector<ComponentProfile> components_;
+  std::vector<ComponentProfile *> looping_profiles_;
+  std::vector<SchedulerItemProfile> scheduler_items_;
+  RuntimeStats iteration_;
+  RuntimeStats jitter_;
+  uint32_t window_start_{0};
+};
+
+}  // namespace esphome
+
+#endif  // USE_LOOP_PROFILER
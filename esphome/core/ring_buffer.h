@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+
+namespace esphome {
+
+/** A fixed-capacity FIFO stored in a single contiguous allocation.
+ *
+ * Storage is allocated once by init() (or resize()) and never grows: pushing into a full buffer overwrites the
+ * oldest element. Elements are indexed from the oldest (0) to the newest (size() - 1), iteration follows the same
+ * order. For reductions where the order does not matter, data() gives the raw storage, all of which is in use while
+ * the buffer is full().
+ */
+template<typename T> class RingBuffer {
+ public:
+  template<typename Buffer, typename Value> class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value *;
+    using reference = Value &;
+
+    Iterator(Buffer *buffer, size_t index) : buffer_(buffer), index_(index) {}
+    reference operator*() const { return (*this->buffer_)[this->index_]; }
+    pointer operator->() const { return &(*this->buffer_)[this->index_]; }
+    Iterator &operator++() {
+      this->index_++;
+      return *this;
+    }
+    Iterator operator++(int) {
+      Iterator copy = *this;
+      this->index_++;
+      return copy;
+    }
+    bool operator==(const Iterator &other) const { return this->index_ == other.index_; }
+    bool operator!=(const Iterator &other) const { return this->index_ != other.index_; }
+
+   protected:
+    Buffer *buffer_;
+    size_t index_;
+  };
+  using iterator = Iterator<RingBuffer, T>;
+  using const_iterator = Iterator<const RingBuffer, const T>;
+
+  RingBuffer() = default;
+  explicit RingBuffer(size_t capacity) { this->init(capacity); }
+
+  /// Allocate storage for capacity elements, dropping the current contents.
+  void init(size_t capacity) {
+    this->data_.reset(capacity == 0 ? nullptr : new T[capacity]);  // NOLINT(cppcoreguidelines-owning-memory)
+    this->capacity_ = capacity;
+    this->clear();
+  }
+  /// Change the capacity, keeping the newest elements that fit.
+  void resize(size_t capacity) {
+    RingBuffer other(capacity);
+    const size_t keep = this->size_ < capacity ? this->size_ : capacity;
+    for (size_t i = this->size_ - keep; i < this->size_; i++)
+      other.push_back((*this)[i]);
+    *this = std::move(other);
+  }
+  void clear() {
+    this->head_ = 0;
+    this->size_ = 0;
+  }
+
+  size_t capacity() const { return this->capacity_; }
+  size_t size() const { return this->size_; }
+  bool empty() const { return this->size_ == 0; }
+  bool full() const { return this->size_ == this->capacity_; }
+
+  /// Append value as the newest element, overwriting the oldest one if the buffer is full.
+  void push_back(const T &value) {
+    if (this->capacity_ == 0)
+      return;
+    if (this->full()) {
+      this->data_[this->head_] = value;
+      this->head_ = this->wrap_(this->head_ + 1);
+      return;
+    }
+    this->data_[this->wrap_(this->head_ + this->size_)] = value;
+    this->size_++;
+  }
+  void pop_front() {
+    this->head_ = this->wrap_(this->head_ + 1);
+    this->size_--;
+  }
+  void pop_back() { this->size_--; }
+
+  T &front() { return this->data_[this->head_]; }
+  const T &front() const { return this->data_[this->head_]; }
+  T &back() { return (*this)[this->size_ - 1]; }
+  const T &back() const { return (*this)[this->size_ - 1]; }
+  T &operator[](size_t index) { return this->data_[this->wrap_(this->head_ + index)]; }
+  const T &operator[](size_t index) const { return this->data_[this->wrap_(this->head_ + index)]; }
+
+  /// Raw storage, not in insertion order.
+  T *data() { return this->data_.get(); }
+  const T *data() const { return this->data_.get(); }
+
+  iterator begin() { return iterator(this, 0); }
+  iterator end() { return iterator(this, this->size_); }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, this->size_); }
+
+ protected:
+  size_t wrap_(size_t index) const { return index >= this->capacity_ ? index - this->capacity_ : index; }
+
+  std::unique_ptr<T[]> data_;
+  size_t capacity_{0};
+  size_t head_{0};
+  size_t size_{0};
+};
+
+}  // namespace esphome
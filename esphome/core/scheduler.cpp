@@ -1,50 +1,57 @@
 #include "scheduler.h"
+#include "esphome/core/application.h"
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/hal.h"
 #include <algorithm>
+#include <cinttypes>
 
 namespace esphome {
 
 static const char *const TAG = "scheduler";
 
-static const uint32_t MAX_LOGICALLY_DELETED_ITEMS = 10;
+static const size_t INDEX_INITIAL_CAPACITY = 16;
 
 // Uncomment to debug scheduler
 // #define ESPHOME_DEBUG_SCHEDULER
 
 void HOT Scheduler::set_timeout(Component *component, const std::string &name, uint32_t timeout,
                                 std::function<void()> func) {
-  const uint32_t now = this->millis_();
+  const uint64_t now = this->millis_();
+  const uint32_t name_hash = hash_name_(name);
 
-  if (!name.empty())
-    this->cancel_timeout(component, name);
+  if (name_hash != NO_NAME) {
+    this->cancel_item_(component, name, name_hash, SchedulerItem::TIMEOUT);
+#ifdef USE_LOOP_PROFILER
+    App.profiler.register_scheduler_item(component, name_hash, name);
+#endif
+  }
 
   if (timeout == SCHEDULER_DONT_RUN)
     return;
 
   ESP_LOGVV(TAG, "set_timeout(name='%s', timeout=%u)", name.c_str(), timeout);
 
-  auto item = make_unique<SchedulerItem>();
-  item->component = component;
-  item->name = name;
-  item->type = SchedulerItem::TIMEOUT;
+  auto *item = this->acquire_(component, name, name_hash, SchedulerItem::TIMEOUT);
   item->timeout = timeout;
-  item->last_execution = now;
-  item->last_execution_major = this->millis_major_;
+  item->next_execution = now + timeout;
   item->callback = std::move(func);
-  item->remove = false;
-  this->push_(std::move(item));
+  this->push_(item);
 }
 bool HOT Scheduler::cancel_timeout(Component *component, const std::string &name) {
-  return this->cancel_item_(component, name, SchedulerItem::TIMEOUT);
+  return this->cancel_item_(component, name, hash_name_(name), SchedulerItem::TIMEOUT);
 }
 void HOT Scheduler::set_interval(Component *component, const std::string &name, uint32_t interval,
                                  std::function<void()> func) {
-  const uint32_t now = this->millis_();
+  const uint64_t now = this->millis_();
+  const uint32_t name_hash = hash_name_(name);
 
-  if (!name.empty())
-    this->cancel_interval(component, name);
+  if (name_hash != NO_NAME) {
+    this->cancel_item_(component, name, name_hash, SchedulerItem::INTERVAL);
+#ifdef USE_LOOP_PROFILER
+    App.profiler.register_scheduler_item(component, name_hash, name);
+#endif
+  }
 
   if (interval == SCHEDULER_DONT_RUN)
     return;
@@ -56,21 +63,15 @@ void HOT Scheduler::set_interval(Component *component, const std::string &name,
 
   ESP_LOGVV(TAG, "set_interval(name='%s', interval=%u, offset=%u)", name.c_str(), interval, offset);
 
-  auto item = make_unique<SchedulerItem>();
-  item->component = component;
-  item->name = name;
-  item->type = SchedulerItem::INTERVAL;
+  auto *item = this->acquire_(component, name, name_hash, SchedulerItem::INTERVAL);
   item->interval = interval;
-  item->last_execution = now - offset - interval;
-  item->last_execution_major = this->millis_major_;
-  if (item->last_execution > now)
-    item->last_execution_major--;
+  // First execution is due right away, the offset only spreads out the following ones
+  item->next_execution = now > offset ? now - offset : 0;
   item->callback = std::move(func);
-  item->remove = false;
-  this->push_(std::move(item));
+  this->push_(item);
 }
 bool HOT Scheduler::cancel_interval(Component *component, const std::string &name) {
-  return this->cancel_item_(component, name, SchedulerItem::INTERVAL);
+  return this->cancel_item_(component, name, hash_name_(name), SchedulerItem::INTERVAL);
 }
 
 struct RetryArgs {
@@ -118,203 +119,312 @@ bool HOT Scheduler::cancel_retry(Component *component, const std::string &name)
 }
 
 optional<uint32_t> HOT Scheduler::next_schedule_in() {
-  if (this->empty_())
+  if (this->items_.empty())
     return {};
-  auto &item = this->items_[0];
-  const uint32_t now = this->millis_();
-  uint32_t next_time = item->last_execution + item->interval;
+  const uint64_t now = this->millis_();
+  const uint64_t next_time = this->items_[0]->next_execution;
   if (next_time < now)
     return 0;
-  return next_time - now;
+  return static_cast<uint32_t>(std::min<uint64_t>(next_time - now, UINT32_MAX));
 }
 void HOT Scheduler::call() {
-  const uint32_t now = this->millis_();
+  const uint64_t now = this->millis_();
   this->process_to_add();
 
 #ifdef ESPHOME_DEBUG_SCHEDULER
-  static uint32_t last_print = 0;
+  static uint64_t last_print = 0;
 
   if (now - last_print > 2000) {
     last_print = now;
-    std::vector<std::unique_ptr<SchedulerItem>> old_items;
-    ESP_LOGVV(TAG, "Items: count=%u, now=%u", this->items_.size(), now);
-    while (!this->empty_()) {
-      auto item = std::move(this->items_[0]);
-      ESP_LOGVV(TAG, "  %s '%s' interval=%u last_execution=%u (%u) next=%u (%u)", item->get_type_str(),
-                item->name.c_str(), item->interval, item->last_execution, item->last_execution_major,
-                item->next_execution(), item->next_execution_major());
-
-      this->pop_raw_();
-      old_items.push_back(std::move(item));
+    ESP_LOGVV(TAG, "Items: count=%u, pool=%u, now=%" PRIu64, this->items_.size(),
+              this->pool_.size() * POOL_BLOCK_SIZE, now);
+    for (auto *item : this->items_) {
+      ESP_LOGVV(TAG, "  %s %08X interval=%u next=%" PRIu64, item->get_type_str(), item->name_hash, item->interval,
+                item->next_execution);
     }
     ESP_LOGVV(TAG, "\n");
-    this->items_ = std::move(old_items);
   }
 #endif  // ESPHOME_DEBUG_SCHEDULER
 
-  auto to_remove_was = to_remove_;
-  auto items_was = items_.size();
-  // If we have too many items to remove
-  if (to_remove_ > MAX_LOGICALLY_DELETED_ITEMS) {
-    std::vector<std::unique_ptr<SchedulerItem>> valid_items;
-    while (!this->empty_()) {
-      auto item = std::move(this->items_[0]);
-      this->pop_raw_();
-      valid_items.push_back(std::move(item));
+  while (!this->items_.empty()) {
+    auto *item = this->items_[0];
+    if (item->next_execution > now) {
+      // Not reached timeout yet, done for this call
+      break;
     }
-    this->items_ = std::move(valid_items);
 
-    // The following should not happen unless I'm missing something
-    if (to_remove_ != 0) {
-      ESP_LOGW(TAG, "to_remove_ was %u now: %u items where %zu now %zu. Please report this", to_remove_was, to_remove_,
-               items_was, items_.size());
-      to_remove_ = 0;
-    }
-  }
+    // Take the item out of the heap while it runs, so that the callback can freely add and cancel items.
+    // Cancelling the running item only flags it, its callback must stay alive until it returns.
+    this->heap_pop_();
+    item->state = SchedulerItem::RUNNING;
 
-  while (!this->empty_()) {
-    // use scoping to indicate visibility of `item` variable
-    {
-      // Don't copy-by value yet
-      auto &item = this->items_[0];
-      if ((now - item->last_execution) < item->interval) {
-        // Not reached timeout yet, done for this call
-        break;
-      }
-      uint8_t major = item->next_execution_major();
-      if (this->millis_major_ - major > 1)
-        break;
-
-      // Don't run on failed components
-      if (item->component != nullptr && item->component->is_failed()) {
-        this->pop_raw_();
-        continue;
-      }
+    // Don't run on failed components
+    if (item->component != nullptr && item->component->is_failed()) {
+      this->index_remove_(item);
+      this->release_(item);
+      continue;
+    }
 
 #ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
-      ESP_LOGVV(TAG, "Running %s '%s' with interval=%u last_execution=%u (now=%u)", item->get_type_str(),
-                item->name.c_str(), item->interval, item->last_execution, now);
+    ESP_LOGVV(TAG, "Running %s %08X with interval=%u next_execution=%" PRIu64 " (now=%" PRIu64 ")",
+              item->get_type_str(), item->name_hash, item->interval, item->next_execution, now);
 #endif
 
-      // Warning: During callback(), a lot of stuff can happen, including:
-      //  - timeouts/intervals get added, potentially invalidating vector pointers
-      //  - timeouts/intervals get cancelled
-      {
-        WarnIfComponentBlockingGuard guard{item->component};
-        item->callback();
-      }
-    }
-
+#ifdef USE_LOOP_PROFILER
+    const uint32_t started = micros();
+#endif
     {
-      // new scope, item from before might have been moved in the vector
-      auto item = std::move(this->items_[0]);
-
-      // Only pop after function call, this ensures we were reachable
-      // during the function call and know if we were cancelled.
-      this->pop_raw_();
+      WarnIfComponentBlockingGuard guard{item->component};
+      item->callback();
+    }
+#ifdef USE_LOOP_PROFILER
+    App.profiler.record_scheduler_item(item->component, item->name_hash, micros() - started);
+#endif
 
-      if (item->remove) {
-        // We were removed/cancelled in the function call, stop
-        to_remove_--;
-        continue;
-      }
+    if (item->remove) {
+      // We were removed/cancelled in the function call, stop
+      this->release_(item);
+      continue;
+    }
 
-      if (item->type == SchedulerItem::INTERVAL) {
-        if (item->interval != 0) {
-          const uint32_t before = item->last_execution;
-          const uint32_t amount = (now - item->last_execution) / item->interval;
-          item->last_execution += amount * item->interval;
-          if (item->last_execution < before)
-            item->last_execution_major++;
-        }
-        this->push_(std::move(item));
+    if (item->type == SchedulerItem::INTERVAL) {
+      if (item->interval != 0) {
+        // Skip executions that were missed, keeping the original phase
+        const uint64_t missed = (now - item->next_execution) / item->interval;
+        item->next_execution += (missed + 1) * item->interval;
       }
+      // Re-added through to_add_ so that interval=0 items run only once per call()
+      this->add_pending_(item);
+    } else {
+      this->index_remove_(item);
+      this->release_(item);
     }
   }
 
   this->process_to_add();
 }
 void HOT Scheduler::process_to_add() {
-  for (auto &it : this->to_add_) {
-    if (it->remove) {
-      continue;
+  for (auto *item : this->to_add_)
+    this->heap_push_(item);
+  this->to_add_.clear();
+}
+uint32_t Scheduler::hash_name_(const std::string &name) {
+  if (name.empty())
+    return NO_NAME;
+  const uint32_t hash = fnv1_hash(name);
+  return hash == NO_NAME ? 1 : hash;
+}
+Scheduler::SchedulerItem *HOT Scheduler::acquire_(Component *component, const std::string &name,
+                                                  uint32_t name_hash, SchedulerItem::Type type) {
+  if (this->free_list_ == nullptr) {
+    // Grow the pool by one block, items are never returned to the heap afterwards
+    std::unique_ptr<SchedulerItem[]> block(new SchedulerItem[POOL_BLOCK_SIZE]);  // NOLINT
+    for (size_t i = 0; i < POOL_BLOCK_SIZE; i++) {
+      block[i].state = SchedulerItem::FREE;
+      block[i].next_free = this->free_list_;
+      this->free_list_ = &block[i];
+    }
+    this->pool_.push_back(std::move(block));
+    // Make sure the heap and the pending list can hold every item without reallocating later
+    const size_t capacity = this->pool_.size() * POOL_BLOCK_SIZE;
+    this->items_.reserve(capacity);
+    this->to_add_.reserve(capacity);
+  }
+
+  auto *item = this->free_list_;
+  this->free_list_ = item->next_free;
+  item->component = component;
+  item->name_hash = name_hash;
+  item->name = name;
+  item->type = type;
+  item->remove = false;
+  return item;
+}
+void HOT Scheduler::release_(SchedulerItem *item) {
+  item->callback = nullptr;
+  item->state = SchedulerItem::FREE;
+  item->next_free = this->free_list_;
+  this->free_list_ = item;
+}
+void HOT Scheduler::add_pending_(SchedulerItem *item) {
+  item->state = SchedulerItem::PENDING;
+  item->position = this->to_add_.size();
+  this->to_add_.push_back(item);
+}
+void HOT Scheduler::push_(SchedulerItem *item) {
+  this->add_pending_(item);
+  if (item->name_hash != NO_NAME)
+    this->index_insert_(item);
+}
+bool HOT Scheduler::cancel_item_(Component *component, const std::string &name, uint32_t name_hash,
+                                 SchedulerItem::Type type) {
+  if (name_hash == NO_NAME)
+    return false;
+  SchedulerItem **slot = this->index_find_(component, name, name_hash, type);
+  if (slot == nullptr)
+    return false;
+
+  SchedulerItem *item = *slot;
+  this->index_erase_(slot);
+  switch (item->state) {
+    case SchedulerItem::QUEUED:
+      this->heap_remove_(item);
+      this->release_(item);
+      break;
+    case SchedulerItem::PENDING: {
+      auto *last = this->to_add_.back();
+      this->to_add_[item->position] = last;
+      last->position = item->position;
+      this->to_add_.pop_back();
+      this->release_(item);
+      break;
     }
+    case SchedulerItem::RUNNING:
+      // Its callback is still on the call stack, released by call() once it returns
+      item->remove = true;
+      break;
+    default:
+      break;
+  }
+  return true;
+}
 
-    this->items_.push_back(std::move(it));
-    std::push_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
+void HOT Scheduler::heap_push_(SchedulerItem *item) {
+  item->state = SchedulerItem::QUEUED;
+  this->items_.push_back(item);
+  item->position = this->items_.size() - 1;
+  this->heap_sift_up_(item->position);
+}
+Scheduler::SchedulerItem *HOT Scheduler::heap_pop_() {
+  auto *top = this->items_[0];
+  this->heap_remove_(top);
+  return top;
+}
+void HOT Scheduler::heap_remove_(SchedulerItem *item) {
+  const size_t index = item->position;
+  auto *last = this->items_.back();
+  this->items_.pop_back();
+  if (last == item)
+    return;
+
+  this->heap_place_(last, index);
+  if (index > 0 && last->next_execution < this->items_[(index - 1) / 2]->next_execution) {
+    this->heap_sift_up_(index);
+  } else {
+    this->heap_sift_down_(index);
   }
-  this->to_add_.clear();
 }
-void HOT Scheduler::cleanup_() {
-  while (!this->items_.empty()) {
-    auto &item = this->items_[0];
-    if (!item->remove)
-      return;
+void HOT Scheduler::heap_place_(SchedulerItem *item, size_t index) {
+  this->items_[index] = item;
+  item->position = index;
+}
+void HOT Scheduler::heap_sift_up_(size_t index) {
+  auto *item = this->items_[index];
+  while (index > 0) {
+    const size_t parent = (index - 1) / 2;
+    if (this->items_[parent]->next_execution <= item->next_execution)
+      break;
+    this->heap_place_(this->items_[parent], index);
+    index = parent;
+  }
+  this->heap_place_(item, index);
+}
+void HOT Scheduler::heap_sift_down_(size_t index) {
+  const size_t size = this->items_.size();
+  auto *item = this->items_[index];
+  while (true) {
+    size_t child = 2 * index + 1;
+    if (child >= size)
+      break;
+    if (child + 1 < size && this->items_[child + 1]->next_execution < this->items_[child]->next_execution)
+      child++;
+    if (item->next_execution <= this->items_[child]->next_execution)
+      break;
+    this->heap_place_(this->items_[child], index);
+    index = child;
+  }
+  this->heap_place_(item, index);
+}
 
-    to_remove_--;
-    this->pop_raw_();
+size_t HOT Scheduler::index_slot_(Component *component, uint32_t name_hash, SchedulerItem::Type type) {
+  uint32_t hash = name_hash ^ (static_cast<uint32_t>(reinterpret_cast<uintptr_t>(component)) * 2654435761UL);
+  hash ^= type;
+  hash ^= hash >> 16;
+  return hash;
+}
+Scheduler::SchedulerItem **HOT Scheduler::index_find_(Component *component, const std::string &name,
+                                                      uint32_t name_hash, SchedulerItem::Type type) {
+  if (this->index_.empty())
+    return nullptr;
+  const size_t mask = this->index_.size() - 1;
+  for (size_t i = index_slot_(component, name_hash, type) & mask;; i = (i + 1) & mask) {
+    SchedulerItem *item = this->index_[i];
+    if (item == nullptr)
+      return nullptr;
+    // The hash only narrows the search, different names may share it
+    if (item->name_hash == name_hash && item->component == component && item->type == type && item->name == name)
+      return &this->index_[i];
   }
 }
-void HOT Scheduler::pop_raw_() {
-  std::pop_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
-  this->items_.pop_back();
+void HOT Scheduler::index_insert_(SchedulerItem *item) {
+  // Keep the load factor at or below 1/2 so that probe sequences stay short
+  if ((this->index_used_ + 1) * 2 > this->index_.size())
+    this->index_rehash_(std::max(INDEX_INITIAL_CAPACITY, this->index_.size() * 2));
+
+  const size_t mask = this->index_.size() - 1;
+  size_t i = index_slot_(item->component, item->name_hash, item->type) & mask;
+  while (this->index_[i] != nullptr)
+    i = (i + 1) & mask;
+  this->index_[i] = item;
+  this->index_used_++;
 }
-void HOT Scheduler::push_(std::unique_ptr<Scheduler::SchedulerItem> item) { this->to_add_.push_back(std::move(item)); }
-bool HOT Scheduler::cancel_item_(Component *component, const std::string &name, Scheduler::SchedulerItem::Type type) {
-  bool ret = false;
-  for (auto &it : this->items_) {
-    if (it->component == component && it->name == name && it->type == type && !it->remove) {
-      to_remove_++;
-      it->remove = true;
-      ret = true;
+void HOT Scheduler::index_remove_(SchedulerItem *item) {
+  if (item->name_hash == NO_NAME || this->index_.empty())
+    return;
+  const size_t mask = this->index_.size() - 1;
+  for (size_t i = index_slot_(item->component, item->name_hash, item->type) & mask; this->index_[i] != nullptr;
+       i = (i + 1) & mask) {
+    if (this->index_[i] == item) {
+      this->index_erase_(&this->index_[i]);
+      return;
     }
   }
-  for (auto &it : this->to_add_) {
-    if (it->component == component && it->name == name && it->type == type) {
-      it->remove = true;
-      ret = true;
+}
+void HOT Scheduler::index_erase_(SchedulerItem **slot) {
+  // Backward-shift deletion, keeps linear probing correct without tombstones
+  const size_t mask = this->index_.size() - 1;
+  size_t hole = slot - this->index_.data();
+  for (size_t i = (hole + 1) & mask; this->index_[i] != nullptr; i = (i + 1) & mask) {
+    SchedulerItem *item = this->index_[i];
+    const size_t home = index_slot_(item->component, item->name_hash, item->type) & mask;
+    // Move the entry into the hole unless its home slot lies cyclically in (hole, i]
+    if (((i - home) & mask) >= ((i - hole) & mask)) {
+      this->index_[hole] = item;
+      hole = i;
     }
   }
-
-  return ret;
+  this->index_[hole] = nullptr;
+  this->index_used_--;
 }
-uint32_t Scheduler::millis_() {
+void Scheduler::index_rehash_(size_t capacity) {
+  std::vector<SchedulerItem *> old;
+  old.swap(this->index_);
+  this->index_.resize(capacity, nullptr);
+  this->index_used_ = 0;
+  for (auto *item : old) {
+    if (item != nullptr)
+      this->index_insert_(item);
+  }
+}
+
+uint64_t Scheduler::millis_() {
   const uint32_t now = millis();
   if (now < this->last_millis_) {
     ESP_LOGD(TAG, "Incrementing scheduler major");
     this->millis_major_++;
   }
   this->last_millis_ = now;
-  return now;
-}
-
-bool HOT Scheduler::SchedulerItem::cmp(const std::unique_ptr<SchedulerItem> &a,
-                                       const std::unique_ptr<SchedulerItem> &b) {
-  // min-heap
-  // return true if *a* will happen after *b*
-  uint32_t a_next_exec = a->next_execution();
-  uint8_t a_next_exec_major = a->next_execution_major();
-  uint32_t b_next_exec = b->next_execution();
-  uint8_t b_next_exec_major = b->next_execution_major();
-
-  if (a_next_exec_major != b_next_exec_major) {
-    // The "major" calculation is quite complicated.
-    // Basically, we need to check if the major value lies in the future or
-    //
-
-    // Here are some cases to think about:
-    // Format: a_major,b_major -> expected result (a-b, b-a)
-    // a=255,b=0 -> false (255, 1)
-    // a=0,b=1 -> false   (255, 1)
-    // a=1,b=0 -> true    (1, 255)
-    // a=0,b=255 -> true  (1, 255)
-
-    uint8_t diff1 = a_next_exec_major - b_next_exec_major;
-    uint8_t diff2 = b_next_exec_major - a_next_exec_major;
-    return diff1 < diff2;
-  }
-
-  return a_next_exec > b_next_exec;
+  return (static_cast<uint64_t>(this->millis_major_) << 32) | now;
 }
 
 }  // namespace esphome
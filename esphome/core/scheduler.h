@@ -8,6 +8,14 @@ namespace esphome {
 
 class Component;
 
+/** Timer backend for set_timeout/set_interval/set_retry.
+ *
+ * Items live in a pool that only grows in fixed-size blocks and recycles freed items, so steady-state
+ * re-arming of timeouts does not touch the heap (apart from what std::function needs for large captures).
+ * Names are looked up by their 32-bit hash through an open-addressing index, the name itself is kept in the
+ * (recycled) item and compared on a hash match, so colliding names never cancel each other. Pending items are
+ * kept in an indexed binary min-heap, so set, cancel and pop are all O(log n).
+ */
 class Scheduler {
  public:
   void set_timeout(Component *component, const std::string &name, uint32_t timeout, std::function<void()> func);
@@ -26,29 +34,31 @@ class Scheduler {
   void process_to_add();
 
  protected:
+  /// Number of items allocated at once whenever the pool runs dry.
+  static const size_t POOL_BLOCK_SIZE = 16;
+  /// Name hash used for anonymous items, these are never indexed and cannot be cancelled.
+  static const uint32_t NO_NAME = 0;
+
   struct SchedulerItem {
     Component *component;
-    std::string name;
-    enum Type { TIMEOUT, INTERVAL } type;
+    uint32_t name_hash;
+    enum Type : uint8_t { TIMEOUT, INTERVAL } type;
+    enum State : uint8_t { FREE, PENDING, QUEUED, RUNNING } state;
+    bool remove;
     union {
       uint32_t interval;
       uint32_t timeout;
     };
-    uint32_t last_execution;
+    uint64_t next_execution;
     std::function<void()> callback;
-    bool remove;
-    uint8_t last_execution_major;
-
-    inline uint32_t next_execution() { return this->last_execution + this->timeout; }
-    inline uint8_t next_execution_major() {
-      uint32_t next_exec = this->next_execution();
-      uint8_t next_exec_major = this->last_execution_major;
-      if (next_exec < this->last_execution)
-        next_exec_major++;
-      return next_exec_major;
-    }
+    /// Kept when the item is recycled, so re-arming a timeout with the same name reuses its storage.
+    std::string name;
+    /// Position in items_ while QUEUED or in to_add_ while PENDING, next free item while FREE.
+    union {
+      size_t position;
+      SchedulerItem *next_free;
+    };
 
-    static bool cmp(const std::unique_ptr<SchedulerItem> &a, const std::unique_ptr<SchedulerItem> &b);
     const char *get_type_str() {
       switch (this->type) {
         case SchedulerItem::INTERVAL:
@@ -61,21 +71,42 @@ class Scheduler {
     }
   };
 
-  uint32_t millis_();
-  void cleanup_();
-  void pop_raw_();
-  void push_(std::unique_ptr<SchedulerItem> item);
-  bool cancel_item_(Component *component, const std::string &name, SchedulerItem::Type type);
-  bool empty_() {
-    this->cleanup_();
-    return this->items_.empty();
-  }
-
-  std::vector<std::unique_ptr<SchedulerItem>> items_;
-  std::vector<std::unique_ptr<SchedulerItem>> to_add_;
+  uint64_t millis_();
+  static uint32_t hash_name_(const std::string &name);
+
+  SchedulerItem *acquire_(Component *component, const std::string &name, uint32_t name_hash,
+                          SchedulerItem::Type type);
+  void release_(SchedulerItem *item);
+  void add_pending_(SchedulerItem *item);
+  void push_(SchedulerItem *item);
+  bool cancel_item_(Component *component, const std::string &name, uint32_t name_hash, SchedulerItem::Type type);
+
+  // Indexed min-heap on next_execution
+  void heap_push_(SchedulerItem *item);
+  SchedulerItem *heap_pop_();
+  void heap_remove_(SchedulerItem *item);
+  void heap_place_(SchedulerItem *item, size_t index);
+  void heap_sift_up_(size_t index);
+  void heap_sift_down_(size_t index);
+
+  // Open-addressing index of named items
+  static size_t index_slot_(Component *component, uint32_t name_hash, SchedulerItem::Type type);
+  SchedulerItem **index_find_(Component *component, const std::string &name, uint32_t name_hash,
+                              SchedulerItem::Type type);
+  void index_insert_(SchedulerItem *item);
+  /// Remove an item that finished or was dropped from the index.
+  void index_remove_(SchedulerItem *item);
+  void index_erase_(SchedulerItem **slot);
+  void index_rehash_(size_t capacity);
+
+  std::vector<SchedulerItem *> items_;
+  std::vector<SchedulerItem *> to_add_;
+  std::vector<SchedulerItem *> index_;
+  size_t index_used_{0};
+  std::vector<std::unique_ptr<SchedulerItem[]>> pool_;
+  SchedulerItem *free_list_{nullptr};
   uint32_t last_millis_{0};
-  uint8_t millis_major_{0};
-  uint32_t to_remove_{0};
+  uint32_t millis_major_{0};
 };
 
 }  // namespace esphome
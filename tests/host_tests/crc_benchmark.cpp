@@ -0,0 +1,141 @@
+// CRC check values, streaming and table-driven vs. bitwise throughput.
+
+#include "host_test.h"
+#include "esphome/core/crc.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace esphome;
+using host_tests::ns_per_op;
+
+// Bit-at-a-time versions as the components had them before the tables
+static uint8_t crc8_maxim_bitwise(uint8_t crc, const uint8_t *data, size_t len) {
+  while (len--) {
+    uint8_t in = *data++;
+    for (uint8_t i = 0; i < 8; i++) {
+      const bool mix = (crc ^ in) & 0x01;
+      crc >>= 1;
+      if (mix)
+        crc ^= 0x8C;
+      in >>= 1;
+    }
+  }
+  return crc;
+}
+
+static uint16_t crc16_bitwise(uint16_t crc, const uint8_t *data, size_t len) {
+  while (len--) {
+    crc ^= *data++;
+    for (uint8_t i = 0; i < 8; i++)
+      crc = (crc & 1) ? (crc >> 1) ^ 0xA001 : crc >> 1;
+  }
+  return crc;
+}
+
+static uint16_t crc16_ccitt_reflected_bitwise(uint16_t crc, const uint8_t *data, size_t len) {
+  while (len--) {
+    crc ^= *data++;
+    for (uint8_t i = 0; i < 8; i++)
+      crc = (crc & 1) ? (crc >> 1) ^ 0x8408 : crc >> 1;
+  }
+  return crc;
+}
+
+static uint16_t crc16_ccitt_bitwise(uint16_t crc, const uint8_t *data, size_t len) {
+  while (len--) {
+    crc ^= uint16_t(*data++) << 8;
+    for (uint8_t i = 0; i < 8; i++)
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+  }
+  return crc;
+}
+
+static uint32_t crc32_bitwise(uint32_t crc, const uint8_t *data, size_t len) {
+  while (len--) {
+    crc ^= *data++;
+    for (uint8_t i = 0; i < 8; i++)
+      crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+  }
+  return crc;
+}
+
+static void test_check_values() {
+  // The "check" value of each variant in the CRC catalogue is the CRC of "123456789"
+  const auto *data = reinterpret_cast<const uint8_t *>("123456789");
+  const size_t len = 9;
+  CHECK(crc8_maxim(data, len) == 0xA1);
+  CHECK(crc16_modbus(data, len) == 0x4B37);
+  CHECK(crc16_update(0, data, len) == 0xBB3D);                                  // CRC-16/ARC
+  CHECK(crc16_ccitt_reflected_update(0, data, len) == 0x2189);                  // CRC-16/KERMIT
+  CHECK(uint16_t(~crc16_ccitt_reflected_update(0xFFFF, data, len)) == 0x906E);  // CRC-16/X-25
+  CHECK(crc16_xmodem(data, len) == 0x31C3);
+  CHECK(crc16_ccitt_update(0xFFFF, data, len) == 0x29B1);  // CRC-16/CCITT-FALSE
+  CHECK(crc32(data, len) == 0xCBF43926);
+}
+
+static void test_matches_bitwise(const std::vector<uint8_t> &data) {
+  for (size_t len : {size_t(0), size_t(1), size_t(7), size_t(64), data.size()}) {
+    const uint8_t *d = data.data();
+    CHECK(crc8_maxim_update(0x5A, d, len) == crc8_maxim_bitwise(0x5A, d, len));
+    CHECK(crc16_update(0xFFFF, d, len) == crc16_bitwise(0xFFFF, d, len));
+    CHECK(crc16_ccitt_reflected_update(0x1234, d, len) == crc16_ccitt_reflected_bitwise(0x1234, d, len));
+    CHECK(crc16_ccitt_update(0xFFFF, d, len) == crc16_ccitt_bitwise(0xFFFF, d, len));
+    CHECK(crc32_update(0xFFFFFFFF, d, len) == crc32_bitwise(0xFFFFFFFF, d, len));
+  }
+}
+
+static void test_streaming(const std::vector<uint8_t> &data) {
+  // Feeding the data in pieces gives the same result as a single call
+  const uint32_t whole = crc32(data.data(), data.size());
+  const uint16_t whole16 = crc16_modbus(data.data(), data.size());
+  uint32_t crc = 0xFFFFFFFF;
+  uint16_t crc16 = 0xFFFF;
+  size_t pos = 0;
+  for (size_t step = 1; pos < data.size(); step = step * 3 % 17 + 1) {
+    const size_t len = std::min(step, data.size() - pos);
+    crc = crc32_update(crc, data.data() + pos, len);
+    crc16 = crc16_update(crc16, data.data() + pos, len);
+    pos += len;
+  }
+  CHECK(~crc == whole);
+  CHECK(crc16 == whole16);
+}
+
+static void benchmark(const std::vector<uint8_t> &data) {
+  const size_t rounds = 2000;
+  const double bytes = double(data.size());
+  volatile uint32_t sink = 0;
+  const uint8_t *d = data.data();
+  const size_t len = data.size();
+
+  printf("%-22s %9s %9s\n", "ns/byte", "table", "bitwise");
+  const auto report = [&](const char *name, double table_ns, double bitwise_ns) {
+    printf("%-22s %9.2f %9.2f\n", name, table_ns / bytes, bitwise_ns / bytes);
+  };
+  report("crc8_maxim", ns_per_op(rounds, [&]() { sink = sink + crc8_maxim_update(0, d, len); }),
+         ns_per_op(rounds, [&]() { sink = sink + crc8_maxim_bitwise(0, d, len); }));
+  report("crc16 (modbus)", ns_per_op(rounds, [&]() { sink = sink + crc16_update(0xFFFF, d, len); }),
+         ns_per_op(rounds, [&]() { sink = sink + crc16_bitwise(0xFFFF, d, len); }));
+  report("crc16_ccitt_reflected",
+         ns_per_op(rounds, [&]() { sink = sink + crc16_ccitt_reflected_update(0, d, len); }),
+         ns_per_op(rounds, [&]() { sink = sink + crc16_ccitt_reflected_bitwise(0, d, len); }));
+  report("crc16_ccitt", ns_per_op(rounds, [&]() { sink = sink + crc16_ccitt_update(0, d, len); }),
+         ns_per_op(rounds, [&]() { sink = sink + crc16_ccitt_bitwise(0, d, len); }));
+  report("crc32", ns_per_op(rounds, [&]() { sink = sink + crc32_update(0xFFFFFFFF, d, len); }),
+         ns_per_op(rounds, [&]() { sink = sink + crc32_bitwise(0xFFFFFFFF, d, len); }));
+}
+
+int main() {
+  std::mt19937 rng(42);
+  std::vector<uint8_t> data(1024);
+  for (auto &b : data)
+    b = uint8_t(rng());
+
+  test_check_values();
+  test_matches_bitwise(data);
+  test_streaming(data);
+  benchmark(data);
+  return host_tests::failures == 0 ? 0 : 1;
+}
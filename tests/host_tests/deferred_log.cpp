@@ -0,0 +1,141 @@
+// Deferred log buffer: concurrent producers, wrap-around at the end of the buffer and dropping when it is full.
+
+#include "host_test.h"
+#include "esphome/components/logger/deferred_log.h"
+
+#include <atomic>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace esphome;
+using namespace esphome::logger;
+
+static const size_t MAX_STRING_LENGTH = 64;
+
+static bool push(DeferredLogBuffer *buffer, const char *tag, const char *format, ...) {
+  va_list args;
+  va_start(args, format);
+  const bool pushed = buffer->push(5, tag, __LINE__, format, args);
+  va_end(args);
+  return pushed;
+}
+
+/// Format the oldest complete record and free it, returns an empty string if there is none.
+static std::string pop(DeferredLogBuffer *buffer) {
+  DeferredLogRecord record;
+  if (!buffer->peek(buffer->get_end(), &record))
+    return "";
+  char text[128];
+  DeferredLogBuffer::format(record, text, sizeof(text));
+  std::string result = std::string(record.tag) + ": " + text;
+  buffer->release(record);
+  return result;
+}
+
+static void test_wrap_around() {
+  DeferredLogBuffer buffer;
+  buffer.init(1024, MAX_STRING_LENGTH);
+  CHECK(buffer.get_capacity() == 1024);
+
+  // Records of changing length never line up with the end of the buffer, so they wrap many times
+  const std::string filler(40, 'x');
+  for (int i = 0; i < 5000; i++) {
+    const int length = i % 37;
+    CHECK(push(&buffer, "wrap", "%d %.*s %u", i, length, filler.c_str(), 0xABCDu));
+    char expected[128];
+    snprintf(expected, sizeof(expected), "wrap: %d %.*s %u", i, length, filler.c_str(), 0xABCDu);
+    CHECK(pop(&buffer) == expected);
+  }
+  CHECK(pop(&buffer).empty());
+  CHECK(buffer.get_dropped() == 0);
+}
+
+static void test_full_buffer() {
+  DeferredLogBuffer buffer;
+  buffer.init(1024, MAX_STRING_LENGTH);
+
+  int pushed = 0;
+  while (push(&buffer, "full", "message %d", pushed))
+    pushed++;
+  CHECK(pushed > 10);
+  CHECK(buffer.get_dropped() == 1);
+  CHECK(!push(&buffer, "full", "message %d", pushed));
+  CHECK(buffer.get_dropped() == 2);
+
+  // Freeing the oldest record makes room for one more, the order is kept
+  CHECK(pop(&buffer) == "full: message 0");
+  CHECK(push(&buffer, "full", "message %d", pushed));
+  for (int i = 1; i <= pushed; i++) {
+    char expected[32];
+    snprintf(expected, sizeof(expected), "full: message %d", i);
+    CHECK(pop(&buffer) == expected);
+  }
+  CHECK(pop(&buffer).empty());
+
+  // A record longer than a quarter of the buffer is never stored
+  const std::string long_string(MAX_STRING_LENGTH, 'y');
+  CHECK(!push(&buffer, "full", "%s %s %s %s", long_string.c_str(), long_string.c_str(), long_string.c_str(),
+              long_string.c_str()));
+  CHECK(buffer.get_dropped() == 3);
+}
+
+static void test_concurrent_producers() {
+  const int producers = 4;
+  const int messages = 20000;
+  DeferredLogBuffer buffer;
+  buffer.init(2048, MAX_STRING_LENGTH);
+
+  std::atomic<int> running{producers};
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; p++) {
+    threads.emplace_back([&buffer, &running, p]() {
+      for (int i = 0; i < messages; i++) {
+        // Retry until the consumer made room, a dropped call still has to be counted
+        while (!push(&buffer, "thread", "%d %d %s", p, i, "payload"))
+          std::this_thread::yield();
+      }
+      running--;
+    });
+  }
+
+  // Every producer's records must arrive complete and in the order they were pushed
+  std::vector<int> next(producers, 0);
+  int received = 0;
+  bool valid = true;
+  while (running > 0 || received < producers * messages) {
+    const std::string text = pop(&buffer);
+    if (text.empty()) {
+      std::this_thread::yield();
+      continue;
+    }
+    int p, i;
+    char payload[16];
+    if (sscanf(text.c_str(), "thread: %d %d %15s", &p, &i, payload) != 3 || p < 0 || p >= producers ||
+        i != next[p] || strcmp(payload, "payload") != 0) {
+      printf("unexpected record: %s\n", text.c_str());
+      valid = false;
+      break;
+    }
+    next[p]++;
+    received++;
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  CHECK(valid);
+  CHECK(received == producers * messages);
+  CHECK(pop(&buffer).empty());
+  printf("concurrent: %d records from %d producers, %u pushes dropped while the buffer was full\n", received,
+         producers, buffer.get_dropped());
+}
+
+int main() {
+  test_wrap_around();
+  test_full_buffer();
+  test_concurrent_producers();
+  return host_tests::failures == 0 ? 0 : 1;
+}
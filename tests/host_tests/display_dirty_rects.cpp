@@ -0,0 +1,203 @@
+// Display buffer dirty regions: merging marked pixels, the rectangle cap, filling and the frame copy diff.
+
+#include "host_test.h"
+#include "esphome/components/display/display_buffer.h"
+
+#include <cstring>
+#include <functional>
+
+using namespace esphome;
+using namespace esphome::display;
+
+/// Display without a bus, the buffer layout is chosen by the tests. Exposes the dirty tracking.
+class TestDisplay : public DisplayBuffer {
+ public:
+  enum Layout {
+    /// One bit per pixel, rows of 8 lines like the SSD1306.
+    PAGES,
+    /// Two bytes per pixel, row by row like the ILI9341 in 16 bit mode.
+    RGB565,
+  };
+
+  TestDisplay(Layout layout, int width, int height) : layout_(layout), width_(width), height_(height) {
+    this->init_internal_(this->buffer_length_());
+    this->clear_dirty_();
+  }
+  void enable_frame_copy() {
+    this->init_frame_copy_(this->buffer_length_(), this->layout_ == PAGES ? this->height_ / 8 : this->height_);
+  }
+
+  void draw_absolute_pixel_internal(int x, int y, Color color) override {
+    if (x < 0 || y < 0 || x >= this->width_ || y >= this->height_)
+      return;
+    if (this->layout_ == PAGES) {
+      const uint32_t pos = x + (y / 8) * this->width_;
+      const uint8_t bit = 1 << (y & 7);
+      const uint8_t value = color.is_on() ? this->buffer_[pos] | bit : this->buffer_[pos] & ~bit;
+      if (this->buffer_[pos] == value)
+        return;
+      this->buffer_[pos] = value;
+    } else {
+      const uint32_t pos = (x + y * this->width_) * 2;
+      const uint16_t value = color.is_on() ? (color.r >> 3) << 11 | (color.g >> 2) << 5 | (color.b >> 3) : 0;
+      if (this->buffer_[pos] == (value >> 8) && this->buffer_[pos + 1] == (value & 0xFF))
+        return;
+      this->buffer_[pos] = value >> 8;
+      this->buffer_[pos + 1] = value & 0xFF;
+    }
+    this->mark_dirty_(x, y);
+  }
+  int get_width_internal() override { return this->width_; }
+  int get_height_internal() override { return this->height_; }
+  DisplayType get_display_type() override {
+    return this->layout_ == PAGES ? DisplayType::DISPLAY_TYPE_BINARY : DisplayType::DISPLAY_TYPE_COLOR;
+  }
+
+  void update() { this->do_update_(); }
+  /// What a driver does after it sent the dirty regions.
+  void sent() { this->clear_dirty_(); }
+
+  void mark(int x, int y) { this->mark_dirty_(x, y); }
+  void mark(int x, int y, int width, int height) { this->mark_dirty_(x, y, width, height); }
+  void fill_rgb565(uint16_t value) {
+    const uint8_t pixel[2] = {uint8_t(value >> 8), uint8_t(value & 0xFF)};
+    this->fill_buffer_(pixel, 2);
+  }
+  uint8_t *buffer() { return this->buffer_; }
+
+  int count() const { return this->dirty_count_; }
+  const DirtyRect &rect(int i) const { return this->dirty_rects_[i]; }
+  bool is_only(int x1, int y1, int x2, int y2) const {
+    if (this->dirty_count_ != 1)
+      return false;
+    const DirtyRect &r = this->dirty_rects_[0];
+    return r.x1 == x1 && r.y1 == y1 && r.x2 == x2 && r.y2 == y2;
+  }
+  bool is_marked(int x, int y) const {
+    for (int i = 0; i < this->dirty_count_; i++) {
+      if (this->dirty_rects_[i].contains(x, y))
+        return true;
+    }
+    return false;
+  }
+
+ protected:
+  uint32_t buffer_length_() const {
+    return this->layout_ == PAGES ? this->width_ * this->height_ / 8 : this->width_ * this->height_ * 2;
+  }
+
+  Layout layout_;
+  int width_;
+  int height_;
+};
+
+static void test_adjacent_pixels() {
+  TestDisplay display(TestDisplay::PAGES, 128, 64);
+  CHECK(display.count() == 0);
+  for (int y = 5; y < 7; y++) {
+    for (int x = 10; x < 20; x++)
+      display.mark(x, y);
+  }
+  CHECK(display.is_only(10, 5, 20, 7));
+
+  // Marking inside the rectangle again doesn't change it
+  display.mark(15, 6);
+  CHECK(display.is_only(10, 5, 20, 7));
+}
+
+static void test_rect_cap() {
+  TestDisplay display(TestDisplay::PAGES, 128, 64);
+  const int points[][2] = {{0, 0}, {120, 0}, {10, 40}, {110, 40}, {60, 20}};
+  for (int i = 0; i < 4; i++)
+    display.mark(points[i][0], points[i][1]);
+  CHECK(display.count() == 4);
+
+  // A fifth distant pixel has to be merged into one of the four
+  display.mark(points[4][0], points[4][1]);
+  CHECK(display.count() == 4);
+  for (const auto &point : points)
+    CHECK(display.is_marked(point[0], point[1]));
+}
+
+static void test_remerge() {
+  TestDisplay display(TestDisplay::PAGES, 128, 64);
+  display.mark(0, 0);
+  display.mark(100, 0);
+  display.mark(127, 63);
+  CHECK(display.count() == 3);
+
+  // Growing the first rectangle towards the second makes sending them as one cheaper
+  display.mark(1, 0, 60, 1);
+  CHECK(display.count() == 2);
+  CHECK(display.rect(0).x1 == 0 && display.rect(0).y1 == 0 && display.rect(0).x2 == 101 && display.rect(0).y2 == 1);
+  CHECK(display.is_marked(127, 63));
+}
+
+static void test_fill_buffer() {
+  TestDisplay display(TestDisplay::RGB565, 64, 32);
+  display.fill_rgb565(0);
+  CHECK(display.count() == 0);
+
+  // Only the changed span of each row is marked
+  display.buffer()[(5 * 64 + 10) * 2] = 1;
+  display.buffer()[(6 * 64 + 12) * 2 + 1] = 1;
+  display.fill_rgb565(0);
+  CHECK(display.is_only(10, 5, 13, 7));
+  bool cleared = true;
+  for (int i = 0; i < 64 * 32 * 2; i++)
+    cleared = cleared && display.buffer()[i] == 0;
+  CHECK(cleared);
+  display.sent();
+
+  // A new color changes every row, so everything is filled and marked at once
+  display.fill_rgb565(0x1234);
+  CHECK(display.is_only(0, 0, 64, 32));
+  bool filled = true;
+  for (int i = 0; i < 64 * 32; i++)
+    filled = filled && display.buffer()[i * 2] == 0x12 && display.buffer()[i * 2 + 1] == 0x34;
+  CHECK(filled);
+}
+
+/// Draw with auto clear twice and check what the second update marks.
+static void test_frame_changes(TestDisplay::Layout layout) {
+  TestDisplay display(layout, 128, 64);
+  display.enable_frame_copy();
+  int x = 20;
+  display.set_writer([&x](DisplayBuffer &it) {
+    it.filled_rectangle(x, 13, 8, 4);
+    it.draw_pixel_at(100, 50, COLOR_ON);
+  });
+  display.update();
+  CHECK(display.count() > 0);
+  display.sent();
+
+  // Redrawing the same frame is cleared and drawn again, but nothing changed
+  display.update();
+  CHECK(display.count() == 0);
+
+  // Only the columns between the old and the new position differ
+  x = 22;
+  display.update();
+  if (layout == TestDisplay::PAGES) {
+    // Rows of the page layout are 8 lines high, the rectangle covers lines 13 to 16
+    CHECK(display.is_only(20, 8, 30, 24));
+  } else {
+    CHECK(display.is_only(20, 13, 30, 17));
+  }
+  display.sent();
+
+  // Pending regions survive an update that changes nothing
+  display.mark(0, 0);
+  display.update();
+  CHECK(display.is_only(0, 0, 1, 1));
+}
+
+int main() {
+  test_adjacent_pixels();
+  test_rect_cap();
+  test_remerge();
+  test_fill_buffer();
+  test_frame_changes(TestDisplay::PAGES);
+  test_frame_changes(TestDisplay::RGB565);
+  return host_tests::failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,169 @@
+// Sliding window sensor filters against sorting/scanning a copy of the window, and their throughput.
+
+#include "host_test.h"
+#include "esphome/components/sensor/filter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <random>
+#include <vector>
+
+using namespace esphome;
+using namespace esphome::sensor;
+using host_tests::ns_per_op;
+
+/// What the filters did before the incremental windows: keep the last values and sort or scan them for every output.
+class ReferenceWindow {
+ public:
+  explicit ReferenceWindow(size_t window_size) : window_size_(window_size) {}
+  void push(float value) {
+    if (this->values_.size() == this->window_size_)
+      this->values_.pop_front();
+    this->values_.push_back(value);
+  }
+  std::vector<float> sorted() const {
+    std::vector<float> sorted;
+    for (float v : this->values_) {
+      if (!std::isnan(v))
+        sorted.push_back(v);
+    }
+    std::sort(sorted.begin(), sorted.end());
+    return sorted;
+  }
+  float median() const {
+    auto s = this->sorted();
+    if (s.empty())
+      return NAN;
+    return s.size() % 2 ? s[s.size() / 2] : (s[s.size() / 2] + s[s.size() / 2 - 1]) / 2.0f;
+  }
+  float quantile(float q) const {
+    auto s = this->sorted();
+    if (s.empty())
+      return NAN;
+    return s[std::max(int(ceilf(s.size() * q)) - 1, 0)];
+  }
+  float min() const {
+    float min = NAN;
+    for (float v : this->values_) {
+      if (!std::isnan(v) && (std::isnan(min) || v < min))
+        min = v;
+    }
+    return min;
+  }
+  float max() const {
+    float max = NAN;
+    for (float v : this->values_) {
+      if (!std::isnan(v) && (std::isnan(max) || v > max))
+        max = v;
+    }
+    return max;
+  }
+
+ protected:
+  size_t window_size_;
+  std::deque<float> values_;
+};
+
+static bool same(optional<float> actual, float expected) {
+  if (!actual.has_value())
+    return false;
+  return std::isnan(expected) ? std::isnan(*actual) : *actual == expected;
+}
+
+static std::vector<float> make_values(size_t count, bool with_nan) {
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<float> dist(-50.0f, 50.0f);
+  std::vector<float> values;
+  for (size_t i = 0; i < count; i++) {
+    // Some repeated values to exercise equal keys, and a run of NaN from an unavailable sensor
+    float v = (i % 11 == 0) ? 1.5f : dist(rng);
+    if (with_nan && (i % 13 == 0 || (i >= 200 && i < 220)))
+      v = NAN;
+    values.push_back(v);
+  }
+  return values;
+}
+
+static void test_against_reference() {
+  const auto values = make_values(1000, true);
+  for (size_t window_size : {1, 2, 5, 16, 33}) {
+    MedianFilter median(window_size, 1, 1);
+    QuantileFilter quantile(window_size, 1, 1, 0.9f);
+    QuantileFilter quantile0(window_size, 1, 1, 0.0f);
+    MinFilter min(window_size, 1, 1);
+    MaxFilter max(window_size, 1, 1);
+    ReferenceWindow reference(window_size);
+    for (float v : values) {
+      reference.push(v);
+      CHECK(same(median.new_value(v), reference.median()));
+      CHECK(same(quantile.new_value(v), reference.quantile(0.9f)));
+      CHECK(same(quantile0.new_value(v), reference.quantile(0.0f)));
+      CHECK(same(min.new_value(v), reference.min()));
+      CHECK(same(max.new_value(v), reference.max()));
+    }
+  }
+}
+
+static void test_send_every() {
+  MedianFilter median(5, 3, 1);
+  int sent = 0;
+  for (int i = 0; i < 10; i++) {
+    if (median.new_value(float(i)).has_value())
+      sent++;
+  }
+  // send_first_at 1, then every third value: values 0, 3, 6 and 9
+  CHECK(sent == 4);
+}
+
+static void test_resize() {
+  MaxFilter max(3, 1, 1);
+  for (float v : {9.0f, 1.0f, 2.0f})
+    max.new_value(v);
+  // Shrinking the window drops the oldest values
+  max.set_window_size(2);
+  CHECK(same(max.new_value(0.0f), 2.0f));
+  max.set_window_size(4);
+  CHECK(same(max.new_value(-1.0f), 2.0f));
+}
+
+static void benchmark() {
+  const auto values = make_values(4096, false);
+  const size_t rounds = 20;
+  volatile float sink = 0;
+  printf("%-8s %-8s %11s %11s\n", "window", "filter", "ns/value", "reference");
+  for (size_t window_size : {15, 101, 501}) {
+    MedianFilter median(window_size, 1, 1);
+    MaxFilter max(window_size, 1, 1);
+    ReferenceWindow reference(window_size);
+    size_t i = 0;
+    const double median_ns = ns_per_op(rounds * values.size(), [&]() {
+      sink = *median.new_value(values[i]);
+      i = (i + 1) % values.size();
+    });
+    const double max_ns = ns_per_op(rounds * values.size(), [&]() {
+      sink = *max.new_value(values[i]);
+      i = (i + 1) % values.size();
+    });
+    const double reference_median_ns = ns_per_op(values.size(), [&]() {
+      reference.push(values[i]);
+      sink = reference.median();
+      i = (i + 1) % values.size();
+    });
+    const double reference_max_ns = ns_per_op(values.size(), [&]() {
+      reference.push(values[i]);
+      sink = reference.max();
+      i = (i + 1) % values.size();
+    });
+    printf("%-8zu %-8s %11.1f %11.1f\n", window_size, "median", median_ns, reference_median_ns);
+    printf("%-8zu %-8s %11.1f %11.1f\n", window_size, "max", max_ns, reference_max_ns);
+  }
+}
+
+int main() {
+  test_against_reference();
+  test_send_every();
+  test_resize();
+  benchmark();
+  return host_tests::failures == 0 ? 0 : 1;
+}
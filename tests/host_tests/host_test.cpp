@@ -0,0 +1,31 @@
+#include "host_test.h"
+#include "esphome/core/hal.h"
+
+#include <cstdlib>
+
+namespace esphome {
+
+namespace host_tests {
+
+int failures = 0;                    // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static uint32_t current_millis = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void set_millis(uint32_t now) { current_millis = now; }
+void advance_millis(uint32_t ms) { current_millis += ms; }
+
+}  // namespace host_tests
+
+// HAL of the host platform with a simulated clock, components/host/core.cpp brings its own main()
+uint32_t millis() { return host_tests::current_millis; }
+uint32_t micros() { return host_tests::current_millis * 1000U; }
+void delay(uint32_t ms) { host_tests::advance_millis(ms); }
+void delayMicroseconds(uint32_t us) {}
+void yield() {}
+void arch_restart() { abort(); }
+void arch_init() {}
+void arch_feed_wdt() {}
+uint8_t progmem_read_byte(const uint8_t *addr) { return *addr; }
+uint32_t arch_get_cpu_cycle_count() { return micros() * 1000U; }
+uint32_t arch_get_cpu_freq_hz() { return 1000000000U; }
+
+}  // namespace esphome
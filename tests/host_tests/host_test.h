@@ -0,0 +1,35 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+namespace esphome {
+namespace host_tests {
+
+/// Set the time returned by millis() and micros(), the tests run on a simulated clock.
+void set_millis(uint32_t now);
+void advance_millis(uint32_t ms);
+
+/// Number of failed CHECKs so far, returned from main() so that ctest reports the failure.
+extern int failures;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/// Run f() count times and return the average time of one call in nanoseconds.
+template<typename F> double ns_per_op(size_t count, F &&f) {
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < count; i++)
+    f();
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::nano>(elapsed).count() / double(count);
+}
+
+}  // namespace host_tests
+}  // namespace esphome
+
+#define CHECK(cond) \
+  do { \
+    if (!(cond)) { \
+      printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+      esphome::host_tests::failures++; \
+    } \
+  } while (false)
@@ -0,0 +1,9 @@
+#pragma once
+
+// Stands in for the defines.h generated for a build, the one in esphome/core enables every feature for static
+// analyzers. The host tests only build the parts of the core that don't depend on feature flags.
+
+#include "esphome/core/macros.h"
+
+#define ESPHOME_BOARD "host"
+#define ESPHOME_VARIANT "host"
@@ -0,0 +1,147 @@
+// Scheduler behaviour checks and set/cancel/call throughput.
+
+#include "host_test.h"
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/scheduler.h"
+
+#include <string>
+#include <vector>
+
+using namespace esphome;
+using host_tests::advance_millis;
+using host_tests::ns_per_op;
+
+static void test_order() {
+  Scheduler scheduler;
+  Component component;
+  std::vector<int> fired;
+  scheduler.set_timeout(&component, "c", 30, [&fired]() { fired.push_back(3); });
+  scheduler.set_timeout(&component, "a", 10, [&fired]() { fired.push_back(1); });
+  scheduler.set_timeout(&component, "b", 20, [&fired]() { fired.push_back(2); });
+  scheduler.set_timeout(&component, "", 20, [&fired]() { fired.push_back(4); });
+  scheduler.call();
+  CHECK(fired.empty());
+  advance_millis(20);
+  scheduler.call();
+  CHECK(fired.size() == 3 && fired[0] == 1);
+  advance_millis(10);
+  scheduler.call();
+  CHECK(fired.size() == 4 && fired[3] == 3);
+  advance_millis(100);
+  scheduler.call();
+  CHECK(fired.size() == 4);
+}
+
+static void test_cancel_and_rearm() {
+  Scheduler scheduler;
+  Component component;
+  int fired = 0;
+  scheduler.set_timeout(&component, "debounce", 10, [&fired]() { fired += 1; });
+  // Re-arming replaces the pending timeout
+  scheduler.set_timeout(&component, "debounce", 20, [&fired]() { fired += 10; });
+  advance_millis(15);
+  scheduler.call();
+  CHECK(fired == 0);
+  advance_millis(10);
+  scheduler.call();
+  CHECK(fired == 10);
+
+  scheduler.set_timeout(&component, "debounce", 10, [&fired]() { fired += 100; });
+  CHECK(scheduler.cancel_timeout(&component, "debounce"));
+  CHECK(!scheduler.cancel_timeout(&component, "debounce"));
+  // Same name on another component or as interval is a different item
+  CHECK(!scheduler.cancel_interval(&component, "debounce"));
+  advance_millis(20);
+  scheduler.call();
+  CHECK(fired == 10);
+}
+
+static void test_interval() {
+  Scheduler scheduler;
+  Component component;
+  int fired = 0;
+  scheduler.set_interval(&component, "poll", 10, [&fired]() { fired++; });
+  // The first execution is due right away
+  scheduler.call();
+  CHECK(fired == 1);
+  for (int i = 0; i < 10; i++) {
+    advance_millis(10);
+    scheduler.call();
+  }
+  CHECK(fired == 11);
+  CHECK(scheduler.cancel_interval(&component, "poll"));
+  advance_millis(100);
+  scheduler.call();
+  CHECK(fired == 11);
+}
+
+static void test_hash_collision() {
+  // Both names have the FNV-1 hash 0x0EDBC043
+  const std::string first = "sensor_889", second = "sensor_475416";
+  CHECK(fnv1_hash(first) == fnv1_hash(second));
+
+  Scheduler scheduler;
+  Component component;
+  int fired = 0;
+  scheduler.set_timeout(&component, first, 10, [&fired]() { fired += 1; });
+  scheduler.set_timeout(&component, second, 10, [&fired]() { fired += 10; });
+  CHECK(scheduler.cancel_timeout(&component, first));
+  CHECK(!scheduler.cancel_timeout(&component, first));
+  advance_millis(10);
+  scheduler.call();
+  CHECK(fired == 10);
+}
+
+static void benchmark() {
+  // Hundreds of named debounce timeouts that are re-armed over and over
+  const size_t count = 500;
+  const size_t rounds = 200;
+  Scheduler scheduler;
+  Component component;
+  std::vector<std::string> names;
+  for (size_t i = 0; i < count; i++)
+    names.push_back("debounce_timeout_" + to_string(i));
+  int fired = 0;
+
+  size_t next = 0;
+  const double set_ns = ns_per_op(count * rounds, [&]() {
+    scheduler.set_timeout(&component, names[next], 1000 + next, [&fired]() { fired++; });
+    next = (next + 1) % count;
+  });
+  next = 0;
+  const double cancel_ns = ns_per_op(count * rounds, [&]() {
+    scheduler.cancel_timeout(&component, names[next]);
+    scheduler.set_timeout(&component, names[next], 1000 + next, [&fired]() { fired++; });
+    next = (next + 1) % count;
+  });
+  for (auto &name : names)
+    scheduler.cancel_timeout(&component, name);
+  scheduler.call();
+  CHECK(fired == 0);
+
+  // Intervals of 1 to 10 ms, so about a fifth of them fire on every millisecond
+  for (size_t i = 0; i < count; i++)
+    scheduler.set_interval(&component, names[i], 1 + (i % 10), [&fired]() { fired++; });
+  scheduler.call();
+  fired = 0;
+  const size_t calls = 2000;
+  const double call_ns = ns_per_op(calls, [&]() {
+    advance_millis(1);
+    scheduler.call();
+  });
+  CHECK(fired > 0);
+
+  printf("set_timeout (re-arm):    %7.1f ns/op\n", set_ns);
+  printf("cancel + set_timeout:    %7.1f ns/op\n", cancel_ns);
+  printf("call:                    %7.1f ns/callback (%d callbacks)\n", call_ns * calls / fired, fired);
+}
+
+int main() {
+  test_order();
+  test_cancel_and_rearm();
+  test_interval();
+  test_hash_collision();
+  benchmark();
+  return host_tests::failures == 0 ? 0 : 1;
+}
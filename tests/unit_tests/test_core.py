@@ -541,3 +541,10 @@ class TestEsphomeCore:
 
         assert target.is_esp32 is False
         assert target.is_esp8266 is True
+
+    def test_is_host(self, target):
+        target.data[const.KEY_CORE] = {const.KEY_TARGET_PLATFORM: "host"}
+
+        assert target.is_esp32 is False
+        assert target.is_esp8266 is False
+        assert target.is_host is True